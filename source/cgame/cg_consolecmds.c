@@ -68,6 +68,18 @@ static void CG_Viewpos_f (void)
 		(int)cg.refdefViewAngles[YAW]);
 }
 
+/*
+=============
+CG_PerfReport_f
+
+Prints the frame timing of the last frames, see CG_PerfReport
+=============
+*/
+static void CG_PerfReport_f(void)
+{
+	CG_PerfReport();
+}
+
 
 static void CG_ScoresDown_f(void)
 {
@@ -131,6 +143,11 @@ static void CG_LoadHud_f(void)
   menuScoreboard = NULL;
 }
 
+static void CG_HudReport_f(void)
+{
+	String_Report();
+}
+
 
 static void CG_scrollScoresDown_f(void)
 {
@@ -569,8 +586,10 @@ static consoleCommand_t	commands[] =
 	{ "vtell_target", CG_VoiceTellTarget_f },
 	{ "vtell_attacker", CG_VoiceTellAttacker_f },
 	{ "tcmd", CG_TargetCommand_f },
+	{ "perfreport", CG_PerfReport_f },
 #ifdef MISSIONPACK
 	{ "loadhud", CG_LoadHud_f },
+	{ "hudreport", CG_HudReport_f },
 	{ "nextTeamMember", CG_NextTeamMember_f },
 	{ "prevTeamMember", CG_PrevTeamMember_f },
 	{ "nextOrder", CG_NextOrder_f },
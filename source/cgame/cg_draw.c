@@ -1035,6 +1035,68 @@ static float CG_DrawSnapshot(float y)
 	return y + BIGCHAR_HEIGHT + 4;
 }
 
+/*
+==================
+CG_DrawLocalEntityStats
+==================
+*/
+static float CG_DrawLocalEntityStats(float y)
+{
+	char		*s;
+	int			w;
+
+	s = va("le:%i frag:%i trace:%i wait:%i hid:%i cull:%i evict:%i %ims",
+		cg_leStats.active, cg_leStats.fragments, cg_leStats.traced, cg_leStats.deferred,
+		cg_leStats.hidden, cg_leStats.culled, cg_leStats.evicted, cg_leStats.msec);
+	w = CG_DrawStrlen(s) * SMALLCHAR_WIDTH;
+
+	CG_DrawSmallString(635 - w, y + 1, s, 1.0f);
+
+	return y + SMALLCHAR_HEIGHT + 2;
+}
+
+/*
+==================
+CG_DrawPerf
+
+Average msec of each phase of the last frames, and what they went through
+==================
+*/
+static float CG_DrawPerf(float y)
+{
+	perfSummary_t	sum;
+	char			*s;
+	int				i, w;
+
+	CG_PerfSummary(&sum);
+	if (!sum.frames)
+	{
+		return y;
+	}
+
+	s = va("frame %i.%i worst %i", sum.intervalAvg / 10, sum.intervalAvg % 10,
+		cg_perf.interval[sum.worstFrame]);
+	w = CG_DrawStrlen(s) * SMALLCHAR_WIDTH;
+	CG_DrawSmallString(635 - w, y + 1, s, 1.0f);
+	y += SMALLCHAR_HEIGHT + 2;
+
+	for (i = 0; i < PERF_NUM_PHASES; i++)
+	{
+		s = va("%s %i.%i/%i", perfPhaseNames[i], sum.avg[i] / 10, sum.avg[i] % 10, sum.worst[i]);
+		w = CG_DrawStrlen(s) * SMALLCHAR_WIDTH;
+		CG_DrawSmallString(635 - w, y + 1, s, 1.0f);
+		y += SMALLCHAR_HEIGHT + 2;
+	}
+
+	s = va("ents:%i pm:%i marks:%i parts:%i le:%i",
+		sum.countAvg[PERFC_ENTITIES], sum.countAvg[PERFC_PMOVES], sum.countAvg[PERFC_MARKS],
+		sum.countAvg[PERFC_PARTICLES], sum.countAvg[PERFC_LOCALENTS]);
+	w = CG_DrawStrlen(s) * SMALLCHAR_WIDTH;
+	CG_DrawSmallString(635 - w, y + 1, s, 1.0f);
+
+	return y + SMALLCHAR_HEIGHT + 2;
+}
+
 /*
 ==================
 CG_DrawFPS
@@ -1183,12 +1245,14 @@ static float CG_DrawTeamOverlay(float y, qboolean right, qboolean upper, qboolea
 	if (pwidth > TEAM_OVERLAY_MAXNAME_WIDTH)
 		pwidth = TEAM_OVERLAY_MAXNAME_WIDTH;
 
-	// max location name width
+	// max location name width, of the locations on the overlay
 	lwidth = 0;
-	/*{
-		for (i = 1; i < MAX_LOCATIONS; i++)
+	for (i = 0; i < count; i++)
+	{
+		ci = cgs.clientinfo + sortedTeamPlayers[i];
+		if (ci->infoValid && ci->team == Team && ci->location > 0 && ci->location < MAX_LOCATIONS)
 		{
-			p = CG_ConfigString(CS_LOCATIONS + i);
+			p = CG_ConfigString(CS_LOCATIONS + ci->location);
 			if (p && *p)
 			{
 				len = CG_DrawStrlen(p);
@@ -1196,7 +1260,7 @@ static float CG_DrawTeamOverlay(float y, qboolean right, qboolean upper, qboolea
 					lwidth = len;
 			}
 		}
-	}*/
+	}
 
 	if (lwidth > TEAM_OVERLAY_MAXLOCATION_WIDTH)
 		lwidth = TEAM_OVERLAY_MAXLOCATION_WIDTH;
@@ -1352,6 +1416,14 @@ static void CG_DrawUpperRight(void)
 	{
 		y = CG_DrawSnapshot(y);
 	}
+	if (cg_debugLocalEnts.integer)
+	{
+		y = CG_DrawLocalEntityStats(y);
+	}
+	if (cg_drawPerf.integer)
+	{
+		y = CG_DrawPerf(y);
+	}
 	//if (cg_drawFPS.integer)
 	{
 		y = CG_DrawFPS(y);
@@ -3001,12 +3073,34 @@ static void CG_DrawCrosshair(void)
 CG_ScanForCrosshairEntity
 =================
 */
+#define	CROSSHAIR_SCAN_MSEC		50
+#define	CROSSHAIR_SCAN_TURN		0.999f		// cosine of how far the view turns before it scans early
+#define	CROSSHAIR_SCAN_MOVE		16
+
 static void CG_ScanForCrosshairEntity(void)
 {
 	trace_t		trace;
-	vec3_t		start, end;
+	vec3_t		start, end, delta;
 	int			content;
 
+	// the name fades over a second, a scan every few frames is plenty unless the view jumped
+	VectorSubtract(cg.refdef.vieworg, cg.crosshairScanOrigin, delta);
+	if (cg.time >= cg.crosshairScanTime && cg.time < cg.crosshairScanTime + CROSSHAIR_SCAN_MSEC
+		&& DotProduct(cg.refdef.viewaxis[0], cg.crosshairScanDir) > CROSSHAIR_SCAN_TURN
+		&& VectorLengthSquared(delta) < Square(CROSSHAIR_SCAN_MOVE))
+	{
+		// keep the name of the one still in sight up
+		if (cg.crosshairScanHit)
+		{
+			cg.crosshairClientTime = cg.time;
+		}
+		return;
+	}
+	cg.crosshairScanTime = cg.time;
+	cg.crosshairScanHit = qfalse;
+	VectorCopy(cg.refdef.vieworg, cg.crosshairScanOrigin);
+	VectorCopy(cg.refdef.viewaxis[0], cg.crosshairScanDir);
+
 	VectorCopy(cg.refdef.vieworg, start);
 	VectorMA(start, 131072, cg.refdef.viewaxis[0], end);
 
@@ -3033,6 +3127,7 @@ static void CG_ScanForCrosshairEntity(void)
 	// update the fade timer
 	cg.crosshairClientNum = trace.entityNum;
 	cg.crosshairClientTime = cg.time;
+	cg.crosshairScanHit = qtrue;
 }
 
 
@@ -3972,7 +4067,9 @@ void CG_DrawActive(stereoFrame_t stereoView)
 		//trap_Cvar_Set("r_drawentities", "0");
 	}
 	else*/
-		trap_R_RenderScene(&cg.refdef);
+	CG_PerfStart(PERF_SCENE);
+	trap_R_RenderScene(&cg.refdef);
+	CG_PerfStop(PERF_SCENE);
 
 	// restore original viewpoint if running stereo
 	if (separation != 0)
@@ -3981,7 +4078,9 @@ void CG_DrawActive(stereoFrame_t stereoView)
 	}
 
 	// draw status bar and other floating elements
+	CG_PerfStart(PERF_DRAW2D);
  	CG_Draw2D();
+	CG_PerfStop(PERF_DRAW2D);
 }
 
 
@@ -465,12 +465,20 @@ void CG_GibPlayer(vec3_t playerOrigin, int entityNum)
 {
 	vec3_t origin, velocity;
 	int Phase;
+	leLod_t lod;
 
 	if (!cg_blood.integer)
 	{
 		return;
 	}
 
+	// nobody sees a body burst in a room out of sight, and far away the head will do
+	lod = CG_LocalEntityLod(playerOrigin);
+	if (lod == LELOD_HIDDEN)
+	{
+		return;
+	}
+
 	VectorCopy(playerOrigin, origin);
 	velocity[0] = crandom()*GIB_VELOCITY;
 	velocity[1] = crandom()*GIB_VELOCITY;
@@ -485,7 +493,7 @@ void CG_GibPlayer(vec3_t playerOrigin, int entityNum)
 	}
 
 	// allow gibs to be turned off for speed
-	if (!cg_gibs.integer)
+	if (!cg_gibs.integer || lod != LELOD_NEAR)
 	{
 		return;
 	}
@@ -549,12 +557,19 @@ void CG_GibPlayer(vec3_t playerOrigin, int entityNum)
 void CG_GibEgg(vec3_t playerOrigin)
 {
 	vec3_t origin, velocity;
+	leLod_t lod;
 
 	if (!cg_blood.integer)
 	{
 		return;
 	}
 
+	lod = CG_LocalEntityLod(playerOrigin);
+	if (lod == LELOD_HIDDEN)
+	{
+		return;
+	}
+
 	VectorCopy(playerOrigin, origin);
 	velocity[0] = crandom()*GIB_VELOCITY;
 	velocity[1] = crandom()*GIB_VELOCITY;
@@ -568,7 +583,7 @@ void CG_GibEgg(vec3_t playerOrigin)
 	CG_LaunchGib(origin, velocity, cgs.media.gibAbdomen, -2, 0);
 
 	// allow gibs to be turned off for speed
-	if (!cg_gibs.integer)
+	if (!cg_gibs.integer || lod != LELOD_NEAR)
 	{
 		return;
 	}
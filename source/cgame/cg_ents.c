@@ -5,6 +5,67 @@
 #include "cg_local.h"
 
 
+/*
+======================
+CG_LerpTag
+
+trap_R_LerpTag through a memo of the tags already lerped. A tag only
+depends on the model, the frames, the fraction and its name, and the
+model handles live as long as cgame, so entries never go stale. The
+weapon models are never animated and all players of a class share
+their models, so most tags of a crowd come out of here. tagName must
+be a string that lives as long as cgame, like the literals passed in.
+======================
+*/
+#define	TAG_CACHE_SIZE	512			// power of two
+
+typedef struct
+{
+	qhandle_t		model;
+	int				startFrame;
+	int				endFrame;
+	float			frac;
+	const char		*tagName;
+	int				found;
+	orientation_t	tag;
+}
+tagCache_t;
+
+static tagCache_t	cg_tagCache[TAG_CACHE_SIZE];
+
+static int CG_LerpTag(orientation_t *tag, qhandle_t model, int startFrame, int endFrame,
+					  float frac, const char *tagName)
+{
+	tagCache_t		*tc;
+	const char		*s;
+	unsigned		hash;
+
+	hash = model * 7919 + startFrame * 131 + endFrame * 31 + (int)(frac * 1024);
+	for (s = tagName; *s; s++)
+	{
+		hash = hash * 33 + *s;
+	}
+	tc = &cg_tagCache[hash & (TAG_CACHE_SIZE - 1)];
+
+	if (tc->tagName && tc->model == model && tc->startFrame == startFrame
+		&& tc->endFrame == endFrame && tc->frac == frac
+		&& (tc->tagName == tagName || !strcmp(tc->tagName, tagName)))
+	{
+		*tag = tc->tag;
+		return tc->found;
+	}
+
+	tc->found = trap_R_LerpTag(&tc->tag, model, startFrame, endFrame, frac, tagName);
+	tc->model = model;
+	tc->startFrame = startFrame;
+	tc->endFrame = endFrame;
+	tc->frac = frac;
+	tc->tagName = tagName;
+
+	*tag = tc->tag;
+	return tc->found;
+}
+
 /*
 ======================
 CG_PositionEntityOnTag
@@ -20,7 +81,7 @@ int CG_PositionEntityOnTag(refEntity_t *entity, const refEntity_t *parent,
 	orientation_t	lerped;
 
 	// lerp the tag
-	Ret = trap_R_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame,
+	Ret = CG_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame,
 		1.0 - parent->backlerp, tagName);
 
 	// FIXME: allow origin offsets along tag?
@@ -55,7 +116,7 @@ int CG_PositionRotatedEntityOnTag(refEntity_t *entity, const refEntity_t *parent
 
 //AxisClear(entity->axis);
 	// lerp the tag
-	Ret = trap_R_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame,
+	Ret = CG_LerpTag(&lerped, parentModel, parent->oldframe, parent->frame,
 		1.0 - parent->backlerp, tagName);
 
 	// FIXME: allow origin offsets along tag?
@@ -635,6 +696,248 @@ static void CG_Missile(centity_t *cent)
 	CG_AddRefEntityWithPowerups(&ent, s1, TEAM_FREE);
 }
 
+/*
+===============================================================================
+
+FLAME STREAMS
+
+The server sends one entity per flamethrower with its two newest puffs.
+The puffs are kept here per client and drawn like the flame missiles
+were. Puffs that fell between two snapshots are put back in between
+the ones that were seen. Each puff traces its flight once, when it
+comes in, to know where it goes out.
+
+===============================================================================
+*/
+
+typedef struct
+{
+	int			time;			// trTime, 0 when it is out
+	int			endTime;
+	qboolean	burning;
+	vec3_t		base;
+	vec3_t		delta;
+} flamePuff_t;
+
+typedef struct
+{
+	int			count;			// time2 of the last state read
+	int			head;			// slot of the next puff
+	int			endTime;		// all puffs are out by then
+	flamePuff_t	puffs[FLAME_STREAM_PUFFS];
+} flameStream_t;
+
+static flameStream_t	cg_flameStreams[MAX_CLIENTS];
+
+/*
+===============
+CG_AddFlamePuff
+===============
+*/
+static void CG_AddFlamePuff(flameStream_t *fs, int clientNum, int time, const vec3_t base, const vec3_t delta, qboolean burning)
+{
+	flamePuff_t	*puff = &fs->puffs[fs->head];
+	trace_t		tr;
+	vec3_t		end;
+	int			life;
+
+	fs->head = (fs->head + 1) % FLAME_STREAM_PUFFS;
+
+	// burning puffs go out on the first burn of the server past es_FlameTime
+	life = es_FlamePreStep + es_FlameTime;
+	if (burning)
+	{
+		life = es_FlamePreStep + (es_FlameTime + FLAME_BURN_MSEC - 1) / FLAME_BURN_MSEC * FLAME_BURN_MSEC;
+	}
+
+	VectorMA(base, life * 0.001f, delta, end);
+	CG_Trace(&tr, base, vec3_origin, vec3_origin, end, clientNum, MASK_SHOT);
+
+	puff->time = time;
+	puff->endTime = time + tr.fraction * life;
+	puff->burning = burning;
+	VectorCopy(base, puff->base);
+	VectorCopy(delta, puff->delta);
+
+	if (puff->endTime > fs->endTime)
+	{
+		fs->endTime = puff->endTime;
+	}
+}
+
+/*
+===============
+CG_FlameStream
+
+Reads the puffs out of a stream entity
+===============
+*/
+static void CG_FlameStream(centity_t *cent)
+{
+	entityState_t	*s1 = &cent->currentState;
+	flameStream_t	*fs;
+	flamePuff_t		*last;
+	vec3_t			base, delta, pos;
+	float			frac;
+	int				n, i, k, missed;
+
+	if ((unsigned)s1->otherEntityNum >= MAX_CLIENTS)
+	{
+		return;
+	}
+	fs = &cg_flameStreams[s1->otherEntityNum];
+
+	// the server counts again from zero after a restart
+	if (s1->time2 < fs->count)
+	{
+		fs->count = 0;
+	}
+	n = s1->time2 - fs->count;
+	fs->count = s1->time2;
+
+	if (n > 1 && s1->apos.trTime)
+	{
+		// fill in the puffs between the last one seen and the previous one sent
+		last = &fs->puffs[(fs->head + FLAME_STREAM_PUFFS - 1) % FLAME_STREAM_PUFFS];
+		missed = n - 2;
+		if (missed > FLAME_STREAM_PUFFS - 2)
+		{
+			missed = FLAME_STREAM_PUFFS - 2;
+		}
+		if (last->time && s1->apos.trTime > last->time
+			&& s1->apos.trTime - last->time <= es_FlameThrowerTime * 2)
+		{
+			for (i = 1; i <= missed; i++)
+			{
+				frac = (float)i / (missed + 1);
+				for (k = 0; k < 3; k++)
+				{
+					base[k] = last->base[k] + frac * (s1->apos.trBase[k] - last->base[k]);
+					delta[k] = last->delta[k] + frac * (s1->apos.trDelta[k] - last->delta[k]);
+				}
+				CG_AddFlamePuff(fs, s1->otherEntityNum, last->time + frac * (s1->apos.trTime - last->time),
+					base, delta, (s1->generic1 & 2) != 0);
+			}
+		}
+		CG_AddFlamePuff(fs, s1->otherEntityNum, s1->apos.trTime, s1->apos.trBase, s1->apos.trDelta,
+			(s1->generic1 & 2) != 0);
+	}
+	if (n > 0)
+	{
+		CG_AddFlamePuff(fs, s1->otherEntityNum, s1->pos.trTime, s1->pos.trBase, s1->pos.trDelta,
+			(s1->generic1 & 1) != 0);
+	}
+
+	// the flames are heard where the newest puff is
+	if (cg_weapons[WP_FLAMETHROWER].missileSound && CG_FlameStreamOrigin(s1->otherEntityNum, pos, 1))
+	{
+		trap_S_AddLoopingSound(s1->number, pos, vec3_origin, cg_weapons[WP_FLAMETHROWER].missileSound);
+	}
+}
+
+/*
+===============
+CG_FlameStreamOrigin
+
+Where the newest puffs of a client are, averaged over at most maxPuffs
+===============
+*/
+qboolean CG_FlameStreamOrigin(int clientNum, vec3_t origin, int maxPuffs)
+{
+	flameStream_t	*fs = &cg_flameStreams[clientNum];
+	flamePuff_t		*puff;
+	vec3_t			pos;
+	int				i, n;
+
+	if (cg.time >= fs->endTime)
+	{
+		return qfalse;
+	}
+
+	VectorClear(origin);
+	for (i = 1, n = 0; i <= FLAME_STREAM_PUFFS && n < maxPuffs; i++)
+	{
+		puff = &fs->puffs[(fs->head + FLAME_STREAM_PUFFS - i) % FLAME_STREAM_PUFFS];
+		if (!puff->time || cg.time >= puff->endTime || cg.time < puff->time)
+		{
+			continue;
+		}
+		VectorMA(puff->base, (cg.time - puff->time) * 0.001f, puff->delta, pos);
+		VectorAdd(origin, pos, origin);
+		n++;
+	}
+	if (!n)
+	{
+		return qfalse;
+	}
+	VectorScale(origin, 1.0f / n, origin);
+	return qtrue;
+}
+
+/*
+===============
+CG_AddFlameStreams
+
+Draws the puffs of every stream, the same sprite and light CG_Missile
+gives a flame missile
+===============
+*/
+void CG_AddFlameStreams(void)
+{
+	flameStream_t		*fs;
+	flamePuff_t			*puff;
+	refEntity_t			ent;
+	const weaponInfo_t	*weapon = &cg_weapons[WP_FLAMETHROWER];
+	float				Coeff;
+	int					i, j, delta;
+
+	for (i = 0, fs = cg_flameStreams; i < MAX_CLIENTS; i++, fs++)
+	{
+		if (cg.time >= fs->endTime)
+		{
+			continue;
+		}
+
+		for (j = 0, puff = fs->puffs; j < FLAME_STREAM_PUFFS; j++, puff++)
+		{
+			if (!puff->time)
+			{
+				continue;
+			}
+			if (cg.time >= puff->endTime)
+			{
+				puff->time = 0;
+				continue;
+			}
+			if (cg.time < puff->time)
+			{
+				continue;
+			}
+
+			delta = cg.time - (puff->time + es_FlamePreStep);
+			Coeff = Square((float)delta * 1.4f / es_FlameTime);
+			if (Coeff > 1)
+				Coeff = 1;
+
+			memset(&ent, 0, sizeof(ent));
+			VectorMA(puff->base, (cg.time - puff->time) * 0.001f, puff->delta, ent.origin);
+			VectorCopy(ent.origin, ent.oldorigin);
+			ent.reType = RT_SPRITE;
+			ent.shaderTime = puff->time / 1000.0;
+			ent.radius = (es_FlameMulRadius * Coeff) + es_FlameBaseRadius;
+			ent.rotation = 0;
+			ent.customShader = cgs.media.FlameShader;
+			trap_R_AddRefEntityToScene(&ent);
+
+			if (puff->burning)
+			{
+				trap_R_AddLightToScene(ent.origin, 200 + (rand()&31), weapon->flashDlightColor[0],
+						weapon->flashDlightColor[1], weapon->flashDlightColor[2]);
+			}
+		}
+	}
+}
+
 /*
 ===============
 CG_Grapple
@@ -1155,6 +1458,9 @@ static void CG_AddCEntity(centity_t *cent)
 	case ET_TEAM:
 		CG_TeamBase(cent);
 		break;
+	case ET_FLAMESTREAM:
+		CG_FlameStream(cent);
+		break;
 	}
 }
 
@@ -581,7 +581,7 @@ Also called by playerstate transition
 */
 void CG_PainEvent(centity_t *cent, int health)
 {
-	char	*snd;
+	customSound_t	snd;
 
 	// don't do more than two pain sounds a second
 	if (cg.time - cent->pe.painTime < 500)
@@ -591,22 +591,22 @@ void CG_PainEvent(centity_t *cent, int health)
 
 	if (health < 25)
 	{
-		snd = "*pain25_1.wav";
+		snd = CSND_PAIN25_1;
 	}
 	else if (health < 50)
 	{
-		snd = "*pain50_1.wav";
+		snd = CSND_PAIN50_1;
 	}
 	else if (health < 75)
 	{
-		snd = "*pain75_1.wav";
+		snd = CSND_PAIN75_1;
 	}
 	else
 	{
-		snd = "*pain100_1.wav";
+		snd = CSND_PAIN100_1;
 	}
 	trap_S_StartSound(NULL, cent->currentState.number, CHAN_VOICE,
-		CG_CustomSound(cent->currentState.number, snd));
+		CG_ClientSound(cent->currentState.number, snd));
 
 	// save pain time for programitic twitch animation
 	cent->pe.painTime = cg.time;
@@ -629,7 +629,6 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 	entityState_t	*es;
 	int				event;
 	vec3_t			dir;
-	const char		*s;
 	int				clientNum;
 	clientInfo_t	*ci;
 
@@ -714,7 +713,7 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 	case EV_FALL_MEDIUM:
 		DEBUGNAME("EV_FALL_MEDIUM");
 		// use normal pain sound
-		trap_S_StartSound(NULL, es->number, CHAN_VOICE, CG_CustomSound(es->number, "*pain100_1.wav"));
+		trap_S_StartSound(NULL, es->number, CHAN_VOICE, CG_ClientSound(es->number, CSND_PAIN100_1));
 		if (clientNum == cg.predictedPlayerState.clientNum)
 		{
 			// smooth landing z changes
@@ -726,7 +725,7 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 	case EV_FALL_FARTHER:
 	case EV_FALL_FAR:
 		DEBUGNAME("EV_FALL_FAR");
-		trap_S_StartSound (NULL, es->number, CHAN_AUTO, CG_CustomSound(es->number, "*fall1.wav"));
+		trap_S_StartSound (NULL, es->number, CHAN_AUTO, CG_ClientSound(es->number, CSND_FALL1));
 		cent->pe.painTime = cg.time;	// don't play a pain sound right after this
 		if (clientNum == cg.predictedPlayerState.clientNum)
 		{
@@ -833,16 +832,16 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 
 		// boing sound at origin, jump sound on player
 		trap_S_StartSound (cent->lerpOrigin, -1, CHAN_VOICE, cgs.media.jumpPadSound);
-		trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_CustomSound(es->number, "*jump1.wav"));
+		trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_ClientSound(es->number, CSND_JUMP1));
 		break;
 
 	case EV_JUMP:
 		DEBUGNAME("EV_JUMP");
-		trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_CustomSound(es->number, "*jump1.wav"));
+		trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_ClientSound(es->number, CSND_JUMP1));
 		break;
 	case EV_TAUNT:
 		DEBUGNAME("EV_TAUNT");
-		trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_CustomSound(es->number, "*taunt.wav"));
+		trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_ClientSound(es->number, CSND_TAUNT));
 		break;
 #ifdef MISSIONPACK
 	case EV_TAUNT_YES:
@@ -884,7 +883,7 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 		break;
 	case EV_WATER_CLEAR:
 		DEBUGNAME("EV_WATER_CLEAR");
-		trap_S_StartSound (NULL, es->number, CHAN_AUTO, CG_CustomSound(es->number, "*gasp.wav"));
+		trap_S_StartSound (NULL, es->number, CHAN_AUTO, CG_ClientSound(es->number, CSND_GASP));
 		break;
 
 	case EV_ITEM_PICKUP:
@@ -1201,6 +1200,11 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 		CG_Bullet(es->pos.trBase, es->otherEntityNum, dir, qtrue, es->eventParm, es->weapon);
 		break;
 
+	case EV_BULLET_HITS:
+		DEBUGNAME("EV_BULLET_HITS");
+		CG_BulletHits(es);
+		break;
+
 	case EV_SHOTGUN:
 		DEBUGNAME("EV_SHOTGUN");
 		CG_ShotgunFire(es, qfalse);
@@ -1217,10 +1221,14 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 		{
 			trap_S_StartSound (NULL, es->number, CHAN_VOICE, cgs.gameSounds[ es->eventParm ]);
 		}
+		else if (cgs.gameCustomSounds[ es->eventParm ])
+		{
+			trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_ClientSound(es->number, cgs.gameCustomSounds[ es->eventParm ] - 1));
+		}
 		else
 		{
-			s = CG_ConfigString(CS_SOUNDS + es->eventParm);
-			trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_CustomSound(es->number, s));
+			// didn't resolve, CG_CustomSound reports an unknown custom sound
+			trap_S_StartSound (NULL, es->number, CHAN_VOICE, CG_CustomSound(es->number, CG_ConfigString(CS_SOUNDS + es->eventParm)));
 		}
 		break;
 
@@ -1230,10 +1238,14 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 		{
 			trap_S_StartSound (NULL, cg.snap->ps.clientNum, CHAN_AUTO, cgs.gameSounds[ es->eventParm ]);
 		}
+		else if (cgs.gameCustomSounds[ es->eventParm ])
+		{
+			trap_S_StartSound (NULL, cg.snap->ps.clientNum, CHAN_AUTO, CG_ClientSound(es->number, cgs.gameCustomSounds[ es->eventParm ] - 1));
+		}
 		else
 		{
-			s = CG_ConfigString(CS_SOUNDS + es->eventParm);
-			trap_S_StartSound (NULL, cg.snap->ps.clientNum, CHAN_AUTO, CG_CustomSound(es->number, s));
+			// didn't resolve, CG_CustomSound reports an unknown custom sound
+			trap_S_StartSound (NULL, cg.snap->ps.clientNum, CHAN_AUTO, CG_CustomSound(es->number, CG_ConfigString(CS_SOUNDS + es->eventParm)));
 		}
 		break;
 
@@ -1415,7 +1427,7 @@ void CG_EntityEvent(centity_t *cent, vec3_t position)
 	case EV_DEATH3:
 		DEBUGNAME("EV_DEATHx");
 		trap_S_StartSound(NULL, es->number, CHAN_VOICE,
-				CG_CustomSound(es->number, va("*death%i.wav", event - EV_DEATH1 + 1)));
+				CG_ClientSound(es->number, CSND_DEATH1 + event - EV_DEATH1));
 		break;
 
 
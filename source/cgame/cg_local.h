@@ -139,6 +139,18 @@ typedef struct
 lerpFrame_t;
 
 
+// what a cosmetic trace down from a player found, reused while the player stays close
+typedef struct
+{
+	qboolean		valid;
+	qboolean		hit;
+	int				groundEntityNum;
+	vec3_t			origin;				// traced from
+	vec3_t			endpos;
+	vec3_t			normal;
+}
+groundCache_t;
+
 typedef struct
 {
 	lerpFrame_t		legs, torso, flag;
@@ -159,6 +171,9 @@ typedef struct
 	int			GunBackTotalTime;
 
 	vec3_t		Flash;
+
+	groundCache_t	shadowCache;
+	groundCache_t	splashCache;
 }
 playerEntity_t;
 
@@ -252,10 +267,29 @@ typedef enum
 	LEF_PUFF_DONT_SCALE  = 0x0001,			// do not scale size over time
 	LEF_TUMBLE			 = 0x0002,			// tumble over time, used for ejecting shells
 	LEF_SOUND1			 = 0x0004,			// sound 1 for kamikaze
-	LEF_SOUND2			 = 0x0008			// sound 2 for kamikaze
+	LEF_SOUND2			 = 0x0008,			// sound 2 for kamikaze
+	LEF_FAR				 = 0x0010,			// fragment past cg_leLodDist
+	LEF_HIDDEN			 = 0x0020,			// fragment far and out of the PVS
+	LEF_DEFERRED		 = 0x0040			// fragment skipped its move last frame
 }
 leFlag_t;
 
+typedef enum
+{
+	LEP_COSMETIC,		// brass, blood trails, resting gibs
+	LEP_NORMAL,
+	LEP_IMPORTANT		// tracers, explosions, rail trails
+}
+lePriority_t;			// what CG_AllocLocalEntity evicts first when the pool is full
+
+typedef enum
+{
+	LELOD_NEAR,
+	LELOD_FAR,			// past cg_leLodDist
+	LELOD_HIDDEN		// past cg_leLodDist and out of the PVS
+}
+leLod_t;
+
 typedef enum
 {
 	LEMT_NONE,
@@ -301,10 +335,81 @@ typedef struct localEntity_s
 	leMarkType_t		leMarkType;		// mark to leave on fragment impact
 	leBounceSoundType_t	leBounceSoundType;
 
+	int				lodTime;			// next LEF_FAR / LEF_HIDDEN check
+
 	refEntity_t		refEntity;
 }
 localEntity_t;
 
+typedef struct
+{
+	int				active;
+	int				fragments;			// flying ones
+	int				traced;
+	int				deferred;
+	int				hidden;
+	int				culled;
+	int				evicted;
+	int				msec;
+}
+localEntityStats_t;					// what CG_AddLocalEntities did last frame
+
+//======================================================================
+
+// the parts of CG_DrawActiveFrame timed for cg_drawPerf and perfreport
+typedef enum
+{
+	PERF_SNAPSHOTS,
+	PERF_PREDICT,
+	PERF_ENTITIES,
+	PERF_MARKS,
+	PERF_PARTICLES,
+	PERF_LOCALENTS,
+	PERF_SCENE,			// trap_R_RenderScene
+	PERF_DRAW2D,
+	PERF_CGAME,			// all of CG_DrawActiveFrame
+	PERF_NUM_PHASES
+}
+perfPhase_t;
+
+typedef enum
+{
+	PERFC_ENTITIES,		// in the snapshot
+	PERFC_PMOVES,
+	PERFC_MARKS,
+	PERFC_PARTICLES,
+	PERFC_LOCALENTS,
+	PERFC_NUM_COUNTS
+}
+perfCount_t;
+
+#define	PERF_FRAMES		64
+
+typedef struct
+{
+	int				frame;
+	int				lastStart;
+	int				start[PERF_NUM_PHASES];
+
+	// rings of the last PERF_FRAMES frames
+	int				msec[PERF_FRAMES][PERF_NUM_PHASES];
+	int				counts[PERF_FRAMES][PERFC_NUM_COUNTS];
+	int				interval[PERF_FRAMES];		// from the previous frame, renderer included
+}
+perfStats_t;
+
+typedef struct
+{
+	int				frames;
+	int				avg[PERF_NUM_PHASES];		// tenths of msec
+	int				worst[PERF_NUM_PHASES];
+	int				countAvg[PERFC_NUM_COUNTS];
+	int				countWorst[PERFC_NUM_COUNTS];
+	int				intervalAvg;				// tenths of msec
+	int				worstFrame;					// ring slot of the longest interval
+}
+perfSummary_t;
+
 //======================================================================
 
 
@@ -335,6 +440,26 @@ score_t;
 // usually as a result of a userinfo (name, model, etc) change
 #define	MAX_CUSTOM_SOUNDS	32
 
+// indexes of the custom sounds, in the order of cg_customSoundNames
+typedef enum
+{
+	CSND_DEATH1,
+	CSND_DEATH2,
+	CSND_DEATH3,
+	CSND_JUMP1,
+	CSND_PAIN25_1,
+	CSND_PAIN50_1,
+	CSND_PAIN75_1,
+	CSND_PAIN100_1,
+	CSND_FALLING1,
+	CSND_GASP,
+	CSND_DROWN,
+	CSND_FALL1,
+	CSND_TAUNT,
+	CSND_NUM_CUSTOM_SOUNDS
+}
+customSound_t;
+
 typedef struct
 {
 	qboolean		infoValid;
@@ -386,6 +511,7 @@ typedef struct
 	vec3_t			headOffset;		// move head in icon views
 	footstep_t		footsteps;
 	gender_t		gender;			// from model
+	int				voiceChatList;	// voice chat list + 1 for the head model, 0 if not looked up yet
 
 	qhandle_t		legsModel;
 	qhandle_t		legsSkin;
@@ -627,6 +753,10 @@ typedef struct
 	// crosshair client ID
 	int			crosshairClientNum;
 	int			crosshairClientTime;
+	int			crosshairScanTime;		// of the last trace
+	qboolean	crosshairScanHit;
+	vec3_t		crosshairScanOrigin;
+	vec3_t		crosshairScanDir;
 
 	// powerup active flashing
 	int			powerupActive;
@@ -1156,6 +1286,7 @@ typedef struct
 	//
 	qhandle_t		gameModels[MAX_MODELS];
 	sfxHandle_t		gameSounds[MAX_SOUNDS];
+	signed char		gameCustomSounds[MAX_SOUNDS];	// customSound_t + 1 of '*' sounds, 0 if none
 
 	int				numInlineModels;
 	qhandle_t		inlineDrawModel[MAX_MODELS];
@@ -1244,9 +1375,14 @@ extern	vmCvar_t		cg_errorDecay;
 extern	vmCvar_t		cg_nopredict;
 extern	vmCvar_t		cg_noPlayerAnims;
 extern	vmCvar_t		cg_showmiss;
+extern	vmCvar_t		cg_pmoveTraces;
 extern	vmCvar_t		cg_footsteps;
 extern	vmCvar_t		cg_addMarks;
 extern	vmCvar_t		cg_brassTime;
+extern	vmCvar_t		cg_leBudget;
+extern	vmCvar_t		cg_leLodDist;
+extern	vmCvar_t		cg_debugLocalEnts;
+extern	vmCvar_t		cg_drawPerf;
 extern	vmCvar_t		cg_gun_frame;
 extern	vmCvar_t		cg_gun_x;
 extern	vmCvar_t		cg_gun_y;
@@ -1310,6 +1446,7 @@ extern	vmCvar_t		cg_enableDust;
 extern	vmCvar_t		cg_enableBreath;
 extern	vmCvar_t		cg_singlePlayerActive;
 extern  vmCvar_t		cg_recordSPDemo;
+extern	vmCvar_t		cg_menuCache;
 extern  vmCvar_t		cg_recordSPDemoName;
 extern	vmCvar_t		cg_obeliskRespawnDelay;
 #endif
@@ -1354,6 +1491,15 @@ void CG_AddBufferedSound(sfxHandle_t sfx);
 
 void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoPlayback);
 
+void CG_PerfStart(perfPhase_t phase);
+void CG_PerfStop(perfPhase_t phase);
+void CG_PerfCount(perfCount_t count, int n);
+void CG_PerfSummary(perfSummary_t *sum);
+void CG_PerfReport(void);
+
+extern	perfStats_t		cg_perf;
+extern	const char		*perfPhaseNames[PERF_NUM_PHASES];
+
 
 //
 // cg_drawtools.c
@@ -1436,6 +1582,8 @@ void CG_Player(centity_t *cent);
 void CG_ResetPlayerEntity(centity_t *cent);
 void CG_AddRefEntityWithPowerups(refEntity_t *ent, entityState_t *state, int team);
 void CG_NewClientInfo(int clientNum, const char	*configstring);
+int			CG_CustomSoundIndex(const char *soundName);
+sfxHandle_t	CG_ClientSound(int clientNum, customSound_t sound);
 sfxHandle_t	CG_CustomSound(int clientNum, const char *soundName);
 void CG_InvCacheAllModels(void);
 
@@ -1466,6 +1614,8 @@ void CG_SetEntitySoundPosition(centity_t *cent);
 void CG_AddPacketEntities(void);
 void CG_Beam(centity_t *cent);
 void CG_AdjustPositionForMover(const vec3_t in, int moverNum, int fromTime, int toTime, vec3_t out);
+void CG_AddFlameStreams(void);
+qboolean CG_FlameStreamOrigin(int clientNum, vec3_t origin, int maxPuffs);
 
 int CG_PositionEntityOnTag(refEntity_t *entity, const refEntity_t *parent,
 							qhandle_t parentModel, char *tagName);
@@ -1489,6 +1639,7 @@ void CG_MissileHitWall(int weapon, int clientNum, vec3_t origin, vec3_t dir, imp
 void CG_MissileHitPlayer(int weapon, vec3_t origin, vec3_t dir, int entityNum);
 void CG_ShotgunFire(entityState_t *es, qboolean Heavy);
 void CG_Bullet(vec3_t origin, int sourceEntityNum, vec3_t normal, qboolean flesh, int fleshEntityNum, qboolean Tracer);
+void CG_BulletHits(entityState_t *es);
 
 void CG_RailTrail(clientInfo_t *ci, vec3_t start, vec3_t end);
 void CG_GrappleTrail(centity_t *ent, const weaponInfo_t *wi);
@@ -1517,6 +1668,9 @@ void	CG_ImpactMark(qhandle_t markShader,
 void	CG_InitLocalEntities(void);
 localEntity_t	*CG_AllocLocalEntity(void);
 void	CG_AddLocalEntities(void);
+leLod_t	CG_LocalEntityLod(const vec3_t origin);
+
+extern	localEntityStats_t	cg_leStats;
 
 //
 // cg_effects.c
@@ -1719,6 +1873,7 @@ void		trap_R_ModelBounds(clipHandle_t model, vec3_t mins, vec3_t maxs);
 int			trap_R_LerpTag(orientation_t *tag, clipHandle_t mod, int startFrame, int endFrame,
 					   float frac, const char *tagName);
 void		trap_R_RemapShader(const char *oldShader, const char *newShader, const char *timeOffset);
+qboolean	trap_R_inPVS(const vec3_t p1, const vec3_t p2);
 
 // The glconfig_t will not change during the life of a cgame.
 // If it needs to change, the entire cgame will be restarted, because
@@ -11,6 +11,16 @@ localEntity_t	cg_localEntities[MAX_LOCAL_ENTITIES];
 localEntity_t	cg_activeLocalEntities;		// double linked list
 localEntity_t	*cg_freeLocalEntities;		// single linked list
 
+localEntityStats_t	cg_leStats;
+
+// CG_AddLocalEntities is running these, eviction must not pull them out from under it
+static localEntity_t	*cg_leCurrent;
+static localEntity_t	*cg_leNext;
+static int				cg_leEvicted;
+
+#define	LE_EVICT_SCAN	32			// oldest entities looked at for one to evict
+#define	LE_LOD_MSEC		250			// how often a fragment checks its distance and PVS
+
 /*
 ===================
 CG_InitLocalEntities
@@ -45,6 +55,11 @@ void CG_FreeLocalEntity(localEntity_t *le)
 		CG_Error("CG_FreeLocalEntity: not active");
 	}
 
+	if (le == cg_leNext)
+	{
+		cg_leNext = le->prev;
+	}
+
 	// remove from the doubly linked active list
 	le->prev->next = le->next;
 	le->next->prev = le->prev;
@@ -54,6 +69,79 @@ void CG_FreeLocalEntity(localEntity_t *le)
 	cg_freeLocalEntities = le;
 }
 
+/*
+===================
+CG_LocalEntityPriority
+===================
+*/
+static lePriority_t CG_LocalEntityPriority(const localEntity_t *le)
+{
+	switch (le->leType)
+	{
+	case LE_TRACER:
+	case LE_EXPLOSION:
+	case LE_SPRITE_EXPLOSION:
+	case LE_FADE_RGB:
+		return LEP_IMPORTANT;
+
+	case LE_FRAGMENT:
+		if ((le->leFlags & LEF_TUMBLE) || le->pos.trType == TR_STATIONARY)
+		{
+			return LEP_COSMETIC;
+		}
+		return LEP_NORMAL;
+
+	case LE_FALL_SCALE_FADE:
+	case LE_MOVE_SCALE_FADE:
+		return LEP_COSMETIC;
+
+	default:
+		return LEP_NORMAL;
+	}
+}
+
+/*
+===================
+CG_EvictLocalEntity
+
+Frees the least important of the oldest active entities
+===================
+*/
+static void CG_EvictLocalEntity(void)
+{
+	localEntity_t	*le, *best;
+	lePriority_t	priority, bestPriority;
+	int				i;
+
+	best = NULL;
+	bestPriority = LEP_IMPORTANT;
+	le = cg_activeLocalEntities.prev;
+	for (i = 0; i < LE_EVICT_SCAN && le != &cg_activeLocalEntities; i++, le = le->prev)
+	{
+		if (le == cg_leCurrent)
+		{
+			continue;
+		}
+		priority = CG_LocalEntityPriority(le);
+		if (!best || priority < bestPriority)
+		{
+			best = le;
+			bestPriority = priority;
+			if (priority == LEP_COSMETIC)
+			{
+				break;
+			}
+		}
+	}
+
+	if (!best)
+	{
+		best = cg_activeLocalEntities.prev;
+	}
+	CG_FreeLocalEntity(best);
+	cg_leEvicted++;
+}
+
 /*
 ===================
 CG_AllocLocalEntity
@@ -67,9 +155,8 @@ localEntity_t	*CG_AllocLocalEntity(void)
 
 	if (!cg_freeLocalEntities)
 	{
-		// no free entities, so free the one at the end of the chain
-		// remove the oldest active entity
-		CG_FreeLocalEntity(cg_activeLocalEntities.prev);
+		// no free entities, so free the least important of the oldest ones
+		CG_EvictLocalEntity();
 	}
 
 	le = cg_freeLocalEntities;
@@ -97,6 +184,65 @@ or generates more localentities along a trail.
 ====================================================================================
 */
 
+/*
+================
+CG_LocalEntityLod
+
+How much of an effect at origin is worth doing
+================
+*/
+leLod_t CG_LocalEntityLod(const vec3_t origin)
+{
+	vec3_t	delta;
+
+	if (cg_leLodDist.value <= 0)
+	{
+		return LELOD_NEAR;
+	}
+
+	VectorSubtract(origin, cg.refdef.vieworg, delta);
+	if (VectorLengthSquared(delta) < Square(cg_leLodDist.value))
+	{
+		return LELOD_NEAR;
+	}
+
+	if (!trap_R_inPVS(cg.refdef.vieworg, origin))
+	{
+		return LELOD_HIDDEN;
+	}
+	return LELOD_FAR;
+}
+
+/*
+================
+CG_FragmentLod
+
+Refreshes LEF_FAR and LEF_HIDDEN every LE_LOD_MSEC or so
+================
+*/
+static void CG_FragmentLod(localEntity_t *le)
+{
+	leLod_t	lod;
+
+	if (cg.time < le->lodTime)
+	{
+		return;
+	}
+	// spread the checks of a burst of gibs over several frames
+	le->lodTime = cg.time + LE_LOD_MSEC + (rand() & 63);
+
+	lod = CG_LocalEntityLod(le->refEntity.origin);
+	le->leFlags &= ~(LEF_FAR|LEF_HIDDEN);
+	if (lod >= LELOD_FAR)
+	{
+		le->leFlags |= LEF_FAR;
+	}
+	if (lod == LELOD_HIDDEN)
+	{
+		le->leFlags |= LEF_HIDDEN;
+	}
+}
+
 /*
 ================
 CG_BloodTrail
@@ -274,6 +420,12 @@ void CG_ReflectVelocity(localEntity_t *le, trace_t *trace)
 /*
 ================
 CG_AddFragment
+
+Fragments far away and out of the PVS are not drawn, resting ones then
+cost nothing more. Flying brass out there is dropped. Past cg_leLodDist
+fragments only clip against the world and leave no blood trail, and
+once cg_leBudget fragments moved in a frame the others wait for the
+next one, though never two frames in a row.
 ================
 */
 void CG_AddFragment(localEntity_t *le)
@@ -281,12 +433,20 @@ void CG_AddFragment(localEntity_t *le)
 	vec3_t	newOrigin;
 	trace_t	trace;
 
+	CG_FragmentLod(le);
+
 	if (le->pos.trType == TR_STATIONARY)
 	{
 		// sink into the ground if near the removal time
 		int		t;
 		float	oldZ;
 
+		if (le->leFlags & LEF_HIDDEN)
+		{
+			cg_leStats.hidden++;
+			return;
+		}
+
 		t = le->endTime - cg.time;
 		if (t < SINK_TIME)
 		{
@@ -308,16 +468,56 @@ void CG_AddFragment(localEntity_t *le)
 		return;
 	}
 
+	cg_leStats.fragments++;
+
+	if (le->leFlags & LEF_HIDDEN)
+	{
+		if (le->leFlags & LEF_TUMBLE)
+		{
+			cg_leStats.culled++;
+			CG_FreeLocalEntity(le);
+			return;
+		}
+		cg_leStats.hidden++;
+	}
+
+	if (cg_leBudget.integer > 0 && cg_leStats.traced >= cg_leBudget.integer
+		&& !(le->leFlags & LEF_DEFERRED))
+	{
+		// the next move traces from where it is now, so nothing gets through walls
+		le->leFlags |= LEF_DEFERRED;
+		cg_leStats.deferred++;
+		if (!(le->leFlags & LEF_HIDDEN))
+		{
+			trap_R_AddRefEntityToScene(&le->refEntity);
+		}
+		return;
+	}
+	le->leFlags &= ~LEF_DEFERRED;
+	cg_leStats.traced++;
+
 	// calculate new position
 	BG_EvaluateTrajectory(&le->pos, cg.time, newOrigin);
 
 	// trace a line from previous position to new position
-	CG_Trace(&trace, le->refEntity.origin, NULL, NULL, newOrigin, -1, CONTENTS_SOLID);
+	if ((le->leFlags & (LEF_TUMBLE|LEF_FAR)))
+	{
+		trap_CM_BoxTrace(&trace, le->refEntity.origin, newOrigin, NULL, NULL, 0, CONTENTS_SOLID);
+	}
+	else
+	{
+		CG_Trace(&trace, le->refEntity.origin, NULL, NULL, newOrigin, -1, CONTENTS_SOLID);
+	}
 	if (trace.fraction == 1.0)
 	{
 		// still in free fall
 		VectorCopy(newOrigin, le->refEntity.origin);
 
+		if (le->leFlags & LEF_HIDDEN)
+		{
+			return;
+		}
+
 		if (le->leFlags & LEF_TUMBLE)
 		{
 			vec3_t angles;
@@ -329,7 +529,7 @@ void CG_AddFragment(localEntity_t *le)
 		trap_R_AddRefEntityToScene(&le->refEntity);
 
 		// add a blood trail
-		if (le->leBounceSoundType == LEBS_BLOOD)
+		if (le->leBounceSoundType == LEBS_BLOOD && !(le->leFlags & LEF_FAR))
 		{
 			CG_BloodTrail(le);
 		}
@@ -355,7 +555,10 @@ void CG_AddFragment(localEntity_t *le)
 	// reflect the velocity on the trace plane
 	CG_ReflectVelocity(le, &trace);
 
-	trap_R_AddRefEntityToScene(&le->refEntity);
+	if (!(le->leFlags & LEF_HIDDEN))
+	{
+		trap_R_AddRefEntityToScene(&le->refEntity);
+	}
 }
 
 /*
@@ -997,16 +1200,24 @@ CG_AddLocalEntities
 */
 void CG_AddLocalEntities(void)
 {
-	localEntity_t	*le, *next;
+	localEntity_t	*le;
+	int				start;
+
+	start = trap_Milliseconds();
+	memset(&cg_leStats, 0, sizeof(cg_leStats));
+	cg_leStats.evicted = cg_leEvicted;
+	cg_leEvicted = 0;
 
 	// walk the list backwards, so any new local entities generated
 	// (trails, marks, etc) will be present this frame
 	le = cg_activeLocalEntities.prev;
-	for (; le != &cg_activeLocalEntities; le = next)
+	for (; le != &cg_activeLocalEntities; le = cg_leNext)
 	{
 		// grab next now, so if the local entity is freed we
 		// still have it
-		next = le->prev;
+		cg_leNext = le->prev;
+		cg_leCurrent = le;
+		cg_leStats.active++;
 
 		if (cg.time >= le->endTime)
 		{
@@ -1074,6 +1285,10 @@ void CG_AddLocalEntities(void)
 #endif
 		}
 	}
+
+	cg_leCurrent = NULL;
+	cg_leNext = NULL;
+	cg_leStats.msec = trap_Milliseconds() - start;
 }
 
 
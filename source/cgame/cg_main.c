@@ -9,7 +9,6 @@
 displayContextDef_t cgDC;
 #endif
 
-int forceModelModificationCount = -1;
 
 void CG_Init(int serverMessageNum, int serverCommandSequence, int clientNum);
 void CG_Shutdown(void);
@@ -107,9 +106,14 @@ vmCvar_t	cg_errorDecay;
 vmCvar_t	cg_nopredict;
 vmCvar_t	cg_noPlayerAnims;
 vmCvar_t	cg_showmiss;
+vmCvar_t	cg_pmoveTraces;
 vmCvar_t	cg_footsteps;
 vmCvar_t	cg_addMarks;
 vmCvar_t	cg_brassTime;
+vmCvar_t	cg_leBudget;
+vmCvar_t	cg_leLodDist;
+vmCvar_t	cg_debugLocalEnts;
+vmCvar_t	cg_drawPerf;
 vmCvar_t	cg_viewsize;
 vmCvar_t	cg_drawGun;
 vmCvar_t	cg_gun_frame;
@@ -147,6 +151,7 @@ vmCvar_t	cg_teamChatsOnly;
 vmCvar_t	cg_noVoiceChats;
 vmCvar_t	cg_noVoiceText;
 vmCvar_t	cg_hudFiles;
+vmCvar_t	cg_menuCache;
 //vmCvar_t 	cg_scorePlum;
 vmCvar_t 	cg_smoothClients;
 vmCvar_t	pmove_fixed;
@@ -188,21 +193,26 @@ typedef struct
 	char		*cvarName;
 	char		*defaultString;
 	int			cvarFlags;
+	cvarUpdate_t	update;			// how often to look for changes
+	void		(*changed)(void);	// called when the value changed
+	int			modificationCount;
 }
 cvarTable_t;
 
+static void CG_ForceModelChange(void);
+
 static cvarTable_t cvarTable[] =
 {
 	{ &cg_ignore, "cg_ignore", "0", 0 },	// used for debugging
 	{ &cg_autoswitch, "cg_autoswitch", "1", CVAR_ARCHIVE },
-	{ &cg_drawGun, "cg_drawGun", "1", CVAR_ARCHIVE },
-	{ &cg_zoomFov, "cg_zoomfov", "22.5", CVAR_ARCHIVE },
-	{ &cg_fov, "cg_fov", "90", CVAR_ARCHIVE },
-	{ &cg_viewsize, "cg_viewsize", "100", CVAR_ARCHIVE },
+	{ &cg_drawGun, "cg_drawGun", "1", CVAR_ARCHIVE, CVU_FRAME },
+	{ &cg_zoomFov, "cg_zoomfov", "22.5", CVAR_ARCHIVE, CVU_FRAME },
+	{ &cg_fov, "cg_fov", "90", CVAR_ARCHIVE, CVU_FRAME },
+	{ &cg_viewsize, "cg_viewsize", "100", CVAR_ARCHIVE, CVU_FRAME },
 	{ &cg_stereoSeparation, "cg_stereoSeparation", "0.4", CVAR_ARCHIVE  },
 	{ &cg_shadows, "cg_shadows", "1", CVAR_ARCHIVE  },
 	{ &cg_gibs, "cg_gibs", "1", CVAR_ARCHIVE  },
-	{ &cg_draw2D, "cg_draw2D", "1", CVAR_ARCHIVE  },
+	{ &cg_draw2D, "cg_draw2D", "1", CVAR_ARCHIVE, CVU_FRAME },
 	{ &cg_drawStatus, "cg_drawStatus", "1", CVAR_ARCHIVE  },
 	{ &cg_drawTimer, "cg_drawTimer", "0", CVAR_ARCHIVE  },
 	{ &cg_drawFPS, "cg_drawFPS", "0", CVAR_ARCHIVE  },
@@ -222,6 +232,10 @@ static cvarTable_t cvarTable[] =
 	{ &cg_crosshairX, "cg_crosshairX", "0", CVAR_ARCHIVE },
 	{ &cg_crosshairY, "cg_crosshairY", "0", CVAR_ARCHIVE },
 	{ &cg_brassTime, "cg_brassTime", "2500", CVAR_ARCHIVE },
+	{ &cg_leBudget, "cg_leBudget", "96", CVAR_ARCHIVE },
+	{ &cg_leLodDist, "cg_leLodDist", "1024", CVAR_ARCHIVE },
+	{ &cg_debugLocalEnts, "cg_debugLocalEnts", "0", 0 },
+	{ &cg_drawPerf, "cg_drawPerf", "0", 0 },
 	{ &cg_simpleItems, "cg_simpleItems", "0", CVAR_ARCHIVE },
 	{ &cg_addMarks, "cg_marks", "1", CVAR_ARCHIVE },
 	{ &cg_lagometer, "cg_lagometer", "1", CVAR_ARCHIVE },
@@ -244,16 +258,17 @@ static cvarTable_t cvarTable[] =
 	{ &cg_nopredict, "cg_nopredict", "0", 0 },
 	{ &cg_noPlayerAnims, "cg_noplayeranims", "0", CVAR_CHEAT },
 	{ &cg_showmiss, "cg_showmiss", "0", 0 },
+	{ &cg_pmoveTraces, "cg_pmoveTraces", "0", 0 },
 	{ &cg_footsteps, "cg_footsteps", "1", CVAR_CHEAT },
 	{ &cg_tracerChance, "cg_tracerchance", "0.4", CVAR_CHEAT },
 	{ &cg_tracerWidth, "cg_tracerwidth", "1", CVAR_CHEAT },
 	{ &cg_tracerLength, "cg_tracerlength", "100", CVAR_CHEAT },
-	{ &cg_thirdPersonRange, "cg_thirdPersonRange", "40", CVAR_CHEAT },
-	{ &cg_thirdPersonAngle, "cg_thirdPersonAngle", "0", CVAR_CHEAT },
-	{ &cg_thirdPerson, "cg_thirdPerson", "0", 0 },
+	{ &cg_thirdPersonRange, "cg_thirdPersonRange", "40", CVAR_CHEAT, CVU_FRAME },
+	{ &cg_thirdPersonAngle, "cg_thirdPersonAngle", "0", CVAR_CHEAT, CVU_FRAME },
+	{ &cg_thirdPerson, "cg_thirdPerson", "0", 0, CVU_FRAME },
 	{ &cg_teamChatTime, "cg_teamChatTime", "3000", CVAR_ARCHIVE  },
 	{ &cg_teamChatHeight, "cg_teamChatHeight", "8", CVAR_ARCHIVE  },
-	{ &cg_forceModel, "cg_forceModel", "0", CVAR_ARCHIVE  },
+	{ &cg_forceModel, "cg_forceModel", "0", CVAR_ARCHIVE, CVU_SECOND, CG_ForceModelChange },
 	{ &cg_predictItems, "cg_predictItems", "1", CVAR_ARCHIVE },
 #ifdef MISSIONPACK
 	{ &cg_deferPlayers, "cg_deferPlayers", "0", CVAR_ARCHIVE },
@@ -261,7 +276,7 @@ static cvarTable_t cvarTable[] =
 	{ &cg_deferPlayers, "cg_deferPlayers", "1", CVAR_ARCHIVE },
 #endif
 	{ &cg_drawTeamOverlay, "cg_drawTeamOverlay", "0", CVAR_ARCHIVE },
-	{ &cg_teamOverlayUserinfo, "teamoverlay", "0", CVAR_ROM | CVAR_USERINFO },
+	{ &cg_teamOverlayUserinfo, "teamoverlay", "0", CVAR_ROM | CVAR_USERINFO, CVU_DEMAND },
 	{ &cg_stats, "cg_stats", "0", 0 },
 	{ &cg_drawFriend, "cg_drawFriend", "1", CVAR_ARCHIVE },
 	{ &cg_teamChatsOnly, "cg_teamChatsOnly", "0", CVAR_ARCHIVE },
@@ -269,14 +284,14 @@ static cvarTable_t cvarTable[] =
 	{ &cg_noVoiceText, "cg_noVoiceText", "0", CVAR_ARCHIVE },
 	// the following variables are created in other parts of the system,
 	// but we also reference them here
-	{ &cg_buildScript, "com_buildScript", "0", 0 },	// force loading of all possible data amd error on failures
-	{ &cg_paused, "cl_paused", "0", CVAR_ROM },
+	{ &cg_buildScript, "com_buildScript", "0", 0, CVU_DEMAND },	// force loading of all possible data amd error on failures
+	{ &cg_paused, "cl_paused", "0", CVAR_ROM, CVU_FRAME },
 	{ &cg_blood, "com_blood", "1", CVAR_ARCHIVE },
-	{ &cg_synchronousClients, "g_synchronousClients", "0", 0 },	// communicated by systeminfo
+	{ &cg_synchronousClients, "g_synchronousClients", "0", 0, CVU_FRAME },	// communicated by systeminfo
 #ifdef MISSIONPACK
 	{ &cg_redTeamName, "g_redteam", DEFAULT_REDTEAM_NAME, CVAR_ARCHIVE | CVAR_SERVERINFO | CVAR_USERINFO },
 	{ &cg_blueTeamName, "g_blueteam", DEFAULT_BLUETEAM_NAME, CVAR_ARCHIVE | CVAR_SERVERINFO | CVAR_USERINFO },
-	{ &cg_currentSelectedPlayer, "cg_currentSelectedPlayer", "0", CVAR_ARCHIVE},
+	{ &cg_currentSelectedPlayer, "cg_currentSelectedPlayer", "0", CVAR_ARCHIVE, CVU_FRAME },
 	{ &cg_currentSelectedPlayerName, "cg_currentSelectedPlayerName", "", CVAR_ARCHIVE},
 	{ &cg_singlePlayer, "ui_singlePlayerActive", "0", CVAR_USERINFO},
 	{ &cg_enableDust, "g_enableDust", "0", CVAR_SERVERINFO},
@@ -286,18 +301,19 @@ static cvarTable_t cvarTable[] =
 	{ &cg_recordSPDemoName, "ui_recordSPDemoName", "", CVAR_ARCHIVE},
 	{ &cg_obeliskRespawnDelay, "g_obeliskRespawnDelay", "10", CVAR_SERVERINFO},
 	{ &cg_hudFiles, "cg_hudFiles", "ui/hud.txt", CVAR_ARCHIVE},
+	{ &cg_menuCache, "cg_menuCache", "1", CVAR_ARCHIVE},
 #endif
-	{ &cg_cameraOrbit, "cg_cameraOrbit", "0", CVAR_CHEAT},
+	{ &cg_cameraOrbit, "cg_cameraOrbit", "0", CVAR_CHEAT, CVU_FRAME },
 	{ &cg_cameraOrbitDelay, "cg_cameraOrbitDelay", "50", CVAR_ARCHIVE},
 	{ &cg_timescaleFadeEnd, "cg_timescaleFadeEnd", "1", 0},
 	{ &cg_timescaleFadeSpeed, "cg_timescaleFadeSpeed", "0", 0},
-	{ &cg_timescale, "timescale", "1", 0},
+	{ &cg_timescale, "timescale", "1", 0, CVU_FRAME },
 	//{ &cg_scorePlum, "cg_scorePlums", "1", CVAR_USERINFO | CVAR_ARCHIVE},
 	{ &cg_smoothClients, "cg_smoothClients", "0", CVAR_USERINFO | CVAR_ARCHIVE},
 	{ &cg_cameraMode, "com_cameraMode", "0", CVAR_CHEAT},
 
-	{ &pmove_fixed, "pmove_fixed", "0", 0},
-	{ &pmove_msec, "pmove_msec", "8", 0},
+	{ &pmove_fixed, "pmove_fixed", "0", 0, CVU_FRAME },
+	{ &pmove_msec, "pmove_msec", "8", 0, CVU_FRAME },
 	{ &cg_noTaunt, "cg_noTaunt", "0", CVAR_ARCHIVE},
 	{ &cg_noProjectileTrail, "cg_noProjectileTrail", "0", CVAR_ARCHIVE},
 	{ &cg_smallFont, "ui_smallFont", "0.25", CVAR_ARCHIVE},
@@ -326,14 +342,13 @@ void CG_RegisterCvars(void)
 	{
 		trap_Cvar_Register(cv->vmCvar, cv->cvarName,
 			cv->defaultString, cv->cvarFlags);
+		cv->modificationCount = cv->vmCvar->modificationCount;
 	}
 
 	// see if we are also running the server on this machine
 	trap_Cvar_VariableStringBuffer("sv_running", var, sizeof(var));
 	cgs.localServer = atoi(var);
 
-	forceModelModificationCount = cg_forceModel.modificationCount;
-
 	trap_Cvar_Register(NULL, "model", DEFAULT_MODEL, CVAR_USERINFO | CVAR_ARCHIVE);
 	trap_Cvar_Register(NULL, "headmodel", DEFAULT_MODEL, CVAR_USERINFO | CVAR_ARCHIVE);
 	trap_Cvar_Register(NULL, "team_model", DEFAULT_TEAM_MODEL, CVAR_USERINFO | CVAR_ARCHIVE);
@@ -362,19 +377,70 @@ static void CG_ForceModelChange(void)
 	}
 }
 
+/*
+=================
+CG_UpdateCvar
+=================
+*/
+static void CG_UpdateCvar(cvarTable_t *cv)
+{
+	trap_Cvar_Update(cv->vmCvar);
+
+	if (cv->modificationCount != cv->vmCvar->modificationCount)
+	{
+		cv->modificationCount = cv->vmCvar->modificationCount;
+		if (cv->changed)
+		{
+			cv->changed();
+		}
+	}
+}
+
 /*
 =================
 CG_UpdateCvars
+
+The per frame cvars are looked at every frame, the others a few per
+frame so that each of them is looked at about once a second.
 =================
 */
 void CG_UpdateCvars(void)
 {
-	int			i;
+	static int	cursor;
+	static int	lastTime;
+	int			i, count, now;
 	cvarTable_t	*cv;
 
 	for (i = 0, cv = cvarTable; i < cvarTableSize; i++, cv++)
 	{
-		trap_Cvar_Update(cv->vmCvar);
+		if (cv->update == CVU_FRAME)
+		{
+			CG_UpdateCvar(cv);
+		}
+	}
+
+	now = trap_Milliseconds();
+	if (now - lastTime >= 1000 || now < lastTime)
+	{
+		count = cvarTableSize;
+		lastTime = now;
+	}
+	else
+	{
+		count = cvarTableSize * (now - lastTime) / 1000;
+		lastTime += count * 1000 / cvarTableSize;
+	}
+	for (i = 0; i < count; i++)
+	{
+		if (cursor >= cvarTableSize)
+		{
+			cursor = 0;
+		}
+		cv = &cvarTable[cursor++];
+		if (cv->update == CVU_SECOND)
+		{
+			CG_UpdateCvar(cv);
+		}
 	}
 
 	// check for modications here
@@ -396,13 +462,6 @@ void CG_UpdateCvars(void)
 		// FIXME E3 HACK
 		trap_Cvar_Set("teamoverlay", "1");
 	}
-
-	// if force model changed
-	if (forceModelModificationCount != cg_forceModel.modificationCount)
-	{
-		forceModelModificationCount = cg_forceModel.modificationCount;
-		CG_ForceModelChange();
-	}
 }
 
 int CG_CrosshairPlayer(void)
@@ -759,8 +818,10 @@ static void CG_RegisterSounds(void)
 		{
 			break;
 		}
+		cgs.gameCustomSounds[i] = 0;
 		if (soundName[0] == '*')
 		{
+			cgs.gameCustomSounds[i] = CG_CustomSoundIndex(soundName) + 1;
 			continue;	// custom sound
 		}
 		cgs.gameSounds[i] = trap_S_RegisterSound(soundName, qfalse);
@@ -1504,7 +1565,7 @@ qboolean CG_Asset_Parse(int handle)
 	//return qfalse;
 }
 
-void CG_ParseMenu(const char *menuFile)
+static void CG_ParseMenuSource(const char *menuFile)
 {
 	pc_token_t token;
 	int handle;
@@ -1561,6 +1622,32 @@ void CG_ParseMenu(const char *menuFile)
 	trap_PC_FreeSource(handle);
 }
 
+/*
+=================
+CG_ParseMenu
+
+Menu files are parsed once and loaded from the menu cache after that,
+see MenuCache_Load.
+=================
+*/
+void CG_ParseMenu(const char *menuFile)
+{
+	if (!cg_menuCache.integer)
+	{
+		CG_ParseMenuSource(menuFile);
+		return;
+	}
+
+	if (MenuCache_Load(menuFile, CG_ParseMenuSource))
+	{
+		return;
+	}
+
+	MenuCache_Begin();
+	CG_ParseMenuSource(menuFile);
+	MenuCache_End(menuFile);
+}
+
 qboolean CG_Load_Menu(char **p)
 {
 	char *token;
@@ -229,12 +229,15 @@ void CG_AddMarks(void)
 	markPoly_t	*mp, *next;
 	int			t;
 	int			fade;
+	int			count;
 
 	if (!cg_addMarks.integer)
 	{
 		return;
 	}
 
+	count = 0;
+
 	mp = cg_activeMarkPolys.nextMark;
 	for (; mp != &cg_activeMarkPolys; mp = next)
 	{
@@ -297,7 +300,10 @@ void CG_AddMarks(void)
 
 
 		trap_R_AddPolyToScene(mp->markShader, mp->poly.numVerts, mp->verts);
+		count++;
 	}
+
+	CG_PerfCount(PERFC_MARKS, count);
 }
 
 // cg_particles.c
@@ -1100,6 +1106,7 @@ void CG_AddParticles (void)
 	cparticle_t		*active, *tail;
 	int				type;
 	vec3_t			rotate_ang;
+	int				count;
 
 	if (!initparticles)
 		CG_ClearParticles ();
@@ -1117,6 +1124,7 @@ void CG_AddParticles (void)
 
 	active = NULL;
 	tail = NULL;
+	count = 0;
 
 	for (p=active_particles ; p ; p=next)
 	{
@@ -1214,9 +1222,11 @@ void CG_AddParticles (void)
 		type = p->type;
 
 		CG_AddParticleToScene (p, org, alpha);
+		count++;
 	}
 
 	active_particles = active;
+	CG_PerfCount(PERFC_PARTICLES, count);
 }
 
 /*
@@ -23,36 +23,62 @@ char	*cg_customSoundNames[MAX_CUSTOM_SOUNDS] =
 
 /*
 ================
-CG_CustomSound
+CG_CustomSoundIndex
 
+returns the customSound_t of a '*' sound name, or -1
 ================
 */
-sfxHandle_t	CG_CustomSound(int clientNum, const char *soundName)
+int CG_CustomSoundIndex(const char *soundName)
 {
-	clientInfo_t *ci;
 	int			i;
 
-	if (soundName[0] != '*')
+	for (i = 0; i < MAX_CUSTOM_SOUNDS && cg_customSoundNames[i]; i++)
 	{
-		return trap_S_RegisterSound(soundName, qfalse);
+		if (!strcmp(soundName, cg_customSoundNames[i]))
+		{
+			return i;
+		}
 	}
+	return -1;
+}
 
+/*
+================
+CG_ClientSound
+
+the sound the client model uses for one of the custom sounds
+================
+*/
+sfxHandle_t	CG_ClientSound(int clientNum, customSound_t sound)
+{
 	if (clientNum < 0 || clientNum >= MAX_CLIENTS)
 	{
 		clientNum = 0;
 	}
-	ci = &cgs.clientinfo[ clientNum ];
+	return cgs.clientinfo[ clientNum ].sounds[ sound ];
+}
 
-	for (i = 0; i < MAX_CUSTOM_SOUNDS && cg_customSoundNames[i]; i++)
+/*
+================
+CG_CustomSound
+
+================
+*/
+sfxHandle_t	CG_CustomSound(int clientNum, const char *soundName)
+{
+	int			i;
+
+	if (soundName[0] != '*')
 	{
-		if (!strcmp(soundName, cg_customSoundNames[i]))
-		{
-			return ci->sounds[i];
-		}
+		return trap_S_RegisterSound(soundName, qfalse);
 	}
 
-	CG_Error("Unknown custom sound: %s", soundName);
-	return 0;
+	i = CG_CustomSoundIndex(soundName);
+	if (i < 0)
+	{
+		CG_Error("Unknown custom sound: %s", soundName);
+	}
+	return CG_ClientSound(clientNum, i);
 }
 
 
@@ -861,6 +887,9 @@ static void CG_LoadClientInfo(clientInfo_t *ci, char *DefaultModel)
 		}
 	}
 
+	// the voice chat list depends on the head model and gender
+	ci->voiceChatList = 0;
+
 	ci->deferred = qfalse;
 
 	// reset any existing players and bodies, because they might be in bad
@@ -2573,9 +2602,74 @@ Returns the Z component of the surface being shadowed
 ===============
 */
 #define	SHADOW_DISTANCE		128
+#define	GROUND_CACHE_DIST	8		// how far a player goes before its shadow and splash are traced again
+
+/*
+===============
+CG_ShadowTrace
+
+The trace down of CG_PlayerShadow. While the player stays within
+GROUND_CACHE_DIST of where it was last traced from, on the same ground
+entity, the ground it found is slid under the player along its plane
+instead. Only the world is traced, so nothing else can get in between.
+===============
+*/
+static void CG_ShadowTrace(centity_t *cent, trace_t *trace)
+{
+	groundCache_t	*gc = &cent->pe.shadowCache;
+	vec3_t			end, mins = {-15, -15, 0}, maxs = {15, 15, 2};
+	float			dx, dy;
+
+	dx = cent->lerpOrigin[0] - gc->origin[0];
+	dy = cent->lerpOrigin[1] - gc->origin[1];
+	if (gc->valid && gc->groundEntityNum == cent->currentState.groundEntityNum
+		&& dx * dx + dy * dy < Square(GROUND_CACHE_DIST))
+	{
+		memset(trace, 0, sizeof(*trace));
+		if (!gc->hit)
+		{
+			// nothing below where it was, nothing below higher up either
+			if (cent->lerpOrigin[2] >= gc->origin[2])
+			{
+				trace->fraction = 1.0;
+				return;
+			}
+		}
+		else
+		{
+			trace->endpos[0] = cent->lerpOrigin[0];
+			trace->endpos[1] = cent->lerpOrigin[1];
+			trace->endpos[2] = gc->endpos[2] - (gc->normal[0] * (cent->lerpOrigin[0] - gc->endpos[0])
+				+ gc->normal[1] * (cent->lerpOrigin[1] - gc->endpos[1])) / gc->normal[2];
+			if (cent->lerpOrigin[2] >= trace->endpos[2])
+			{
+				trace->fraction = (cent->lerpOrigin[2] - trace->endpos[2]) / SHADOW_DISTANCE;
+				if (trace->fraction > 1.0)
+				{
+					trace->fraction = 1.0;
+				}
+				VectorCopy(gc->normal, trace->plane.normal);
+				return;
+			}
+		}
+	}
+
+	// send a trace down from the player to the ground
+	VectorCopy(cent->lerpOrigin, end);
+	end[2] -= SHADOW_DISTANCE;
+
+	trap_CM_BoxTrace(trace, cent->lerpOrigin, end, mins, maxs, 0, MASK_PLAYERSOLID);
+
+	gc->hit = (trace->fraction != 1.0);
+	gc->valid = !trace->startsolid && !trace->allsolid && (!gc->hit || trace->plane.normal[2] > 0.1f);
+	gc->groundEntityNum = cent->currentState.groundEntityNum;
+	VectorCopy(cent->lerpOrigin, gc->origin);
+	VectorCopy(trace->endpos, gc->endpos);
+	VectorCopy(trace->plane.normal, gc->normal);
+}
+
 static qboolean CG_PlayerShadow(centity_t *cent, float *shadowPlane)
 {
-	vec3_t		end, mins = {-15, -15, 0}, maxs = {15, 15, 2};
 	trace_t		trace;
 	float		alpha;
 	vec4_t color;
@@ -2593,11 +2687,7 @@ static qboolean CG_PlayerShadow(centity_t *cent, float *shadowPlane)
 		return qfalse;
 	}
 
-	// send a trace down from the player to the ground
-	VectorCopy(cent->lerpOrigin, end);
-	end[2] -= SHADOW_DISTANCE;
-
-	trap_CM_BoxTrace(&trace, cent->lerpOrigin, end, mins, maxs, 0, MASK_PLAYERSOLID);
+	CG_ShadowTrace(cent, &trace);
 
 	// no shadow if too high
 	if (trace.fraction == 1.0 || trace.startsolid || trace.allsolid)
@@ -2630,22 +2720,15 @@ static qboolean CG_PlayerShadow(centity_t *cent, float *shadowPlane)
 
 /*
 ===============
-CG_PlayerSplash
+CG_SplashTrace
 
-Draw a mark at the water surface
+Finds the water surface a player is standing in, if any
 ===============
 */
-static void CG_PlayerSplash(centity_t *cent)
+static qboolean CG_SplashTrace(centity_t *cent, trace_t *trace)
 {
 	vec3_t		start, end;
-	trace_t		trace;
 	int			contents;
-	polyVert_t	verts[4];
-
-	if (!cg_shadows.integer)
-	{
-		return;
-	}
 
 	VectorCopy(cent->lerpOrigin, end);
 	end[2] -= 24;
@@ -2655,7 +2738,7 @@ static void CG_PlayerSplash(centity_t *cent)
 	contents = trap_CM_PointContents(end, 0);
 	if (!(contents & (CONTENTS_WATER | CONTENTS_SLIME | CONTENTS_LAVA)))
 	{
-		return;
+		return qfalse;
 	}
 
 	VectorCopy(cent->lerpOrigin, start);
@@ -2665,17 +2748,66 @@ static void CG_PlayerSplash(centity_t *cent)
 	contents = trap_CM_PointContents(start, 0);
 	if (contents & (CONTENTS_SOLID | CONTENTS_WATER | CONTENTS_SLIME | CONTENTS_LAVA))
 	{
-		return;
+		return qfalse;
 	}
 
 	// trace down to find the surface
-	trap_CM_BoxTrace(&trace, start, end, NULL, NULL, 0, (CONTENTS_WATER | CONTENTS_SLIME | CONTENTS_LAVA));
+	trap_CM_BoxTrace(trace, start, end, NULL, NULL, 0, (CONTENTS_WATER | CONTENTS_SLIME | CONTENTS_LAVA));
+
+	if (trace->fraction == 1.0)
+	{
+		return qfalse;
+	}
 
-	if (trace.fraction == 1.0)
+	return qtrue;
+}
+
+/*
+===============
+CG_PlayerSplash
+
+Draw a mark at the water surface
+===============
+*/
+static void CG_PlayerSplash(centity_t *cent)
+{
+	vec3_t		delta;
+	trace_t		trace;
+	polyVert_t	verts[4];
+	groundCache_t	*gc = &cent->pe.splashCache;
+
+	if (!cg_shadows.integer)
 	{
 		return;
 	}
 
+	// water surfaces are flat, the last answer holds while the player stays close
+	VectorSubtract(cent->lerpOrigin, gc->origin, delta);
+	if (gc->valid && gc->groundEntityNum == cent->currentState.groundEntityNum
+		&& VectorLengthSquared(delta) < Square(GROUND_CACHE_DIST))
+	{
+		if (!gc->hit)
+		{
+			return;
+		}
+		VectorCopy(cent->lerpOrigin, trace.endpos);
+		trace.endpos[2] = gc->endpos[2];
+	}
+	else
+	{
+		gc->valid = qtrue;
+		gc->hit = qfalse;
+		gc->groundEntityNum = cent->currentState.groundEntityNum;
+		VectorCopy(cent->lerpOrigin, gc->origin);
+
+		if (!CG_SplashTrace(cent, &trace))
+		{
+			return;
+		}
+		gc->hit = qtrue;
+		VectorCopy(trace.endpos, gc->endpos);
+	}
+
 	// create a mark polygon
 	VectorCopy(trace.endpos, verts[0].xyz);
 	verts[0].xyz[0] -= 32;
@@ -3402,6 +3534,9 @@ void CG_ResetPlayerEntity(centity_t *cent)
 	cent->pe.legs.pitching = qfalse;
 
 	memset(&cent->pe.torso, 0, sizeof(cent->pe.legs));
+
+	cent->pe.shadowCache.valid = qfalse;
+	cent->pe.splashCache.valid = qfalse;
 	cent->pe.torso.yawAngle = cent->rawAngles[YAW];
 	cent->pe.torso.yawing = qfalse;
 	cent->pe.torso.pitchAngle = cent->rawAngles[PITCH];
@@ -14,6 +14,12 @@ static	centity_t	*cg_solidEntities[MAX_ENTITIES_IN_SNAPSHOT];
 static	int			cg_numTriggerEntities;
 static	centity_t	*cg_triggerEntities[MAX_ENTITIES_IN_SNAPSHOT];
 
+// pmove trace counts for cg_pmoveTraces
+static	int			cg_pmoveStatsTime;
+static	int			cg_pmoveStatsMoves;
+static	int			cg_pmoveStatsTraces;
+static	int			cg_pmoveStatsMemoHits;
+
 /*
 ====================
 CG_BuildSolidList
@@ -432,6 +438,40 @@ static void CG_TouchTriggerPrediction(void)
 
 
 
+/*
+=================
+CG_PmoveTraceStats
+
+Sums the traces done by prediction, including the commands replayed
+from the snapshot every frame, and prints them every cg_pmoveTraces seconds
+=================
+*/
+static void CG_PmoveTraceStats(void)
+{
+	if (cg_pmoveTraces.integer <= 0)
+	{
+		return;
+	}
+
+	cg_pmoveStatsMoves++;
+	cg_pmoveStatsTraces += cg_pmove.numTraces;
+	cg_pmoveStatsMemoHits += cg_pmove.numTraceMemoHits;
+
+	if (cg.time < cg_pmoveStatsTime)
+	{
+		return;
+	}
+	cg_pmoveStatsTime = cg.time + cg_pmoveTraces.integer * 1000;
+
+	CG_Printf("pmove: %i moves, %.1f traces/move, %i%% from memo\n", cg_pmoveStatsMoves,
+		(float)cg_pmoveStatsTraces / cg_pmoveStatsMoves,
+		cg_pmoveStatsTraces ? cg_pmoveStatsMemoHits * 100 / cg_pmoveStatsTraces : 0);
+
+	cg_pmoveStatsMoves = 0;
+	cg_pmoveStatsTraces = 0;
+	cg_pmoveStatsMemoHits = 0;
+}
+
 /*
 =================
 CG_PredictPlayerState
@@ -661,6 +701,8 @@ void CG_PredictPlayerState(void)
 		}
 
 		Pmove (&cg_pmove, &cgs.InvasionInfo);
+		CG_PmoveTraceStats();
+		CG_PerfCount(PERFC_PMOVES, 1);
 
 		moved = qtrue;
 
@@ -106,16 +106,25 @@ CG_ParseTeamInfo
 */
 static void CG_ParseTeamInfo(void)
 {
-	int		i;
+	int		i, num;
 	int		client;
+	// the Invasion stats feed keeps the overlay list there
+	qboolean	sortPlayers = (cgs.gametype != GT_INVASION && cgs.gametype != GT_DESTROY);
 
-	numSortedTeamPlayers = atoi(CG_Argv(1));
+	num = atoi(CG_Argv(1));
+	if (num > TEAM_MAXOVERLAY)
+		num = TEAM_MAXOVERLAY;
+	if (sortPlayers)
+		numSortedTeamPlayers = num;
 
-	for (i = 0; i < numSortedTeamPlayers; i++)
+	for (i = 0; i < num; i++)
 	{
 		client = atoi(CG_Argv(i * 6 + 2));
+		if (client < 0 || client >= MAX_CLIENTS)
+			continue;
 
-		sortedTeamPlayers[i] = client;
+		if (sortPlayers)
+			sortedTeamPlayers[i] = client;
 
 		cgs.clientinfo[ client ].location = atoi(CG_Argv(i * 6 + 3));
 		cgs.clientinfo[ client ].health = atoi(CG_Argv(i * 6 + 4));
@@ -512,6 +521,9 @@ static void CG_ConfigStringModified(void)
 	{
 		if (str[0] != '*') {	// player specific sounds don't register here
 			cgs.gameSounds[num-CS_SOUNDS] = trap_S_RegisterSound(str, qfalse);
+			cgs.gameCustomSounds[num-CS_SOUNDS] = 0;
+		} else {
+			cgs.gameCustomSounds[num-CS_SOUNDS] = CG_CustomSoundIndex(str) + 1;
 		}
 	}
 	else if (num >= CS_PLAYERS && num < CS_PLAYERS+MAX_CLIENTS)
@@ -734,6 +746,7 @@ static void CG_MapRestart(void)
 #define MAX_VOICESOUNDS		64
 #define MAX_CHATSIZE		64
 #define MAX_HEADMODELS		64
+#define VOICECHAT_HASHSIZE	128		// power of two, larger than MAX_VOICECHATS
 
 typedef struct voiceChat_s
 {
@@ -750,6 +763,7 @@ typedef struct voiceChatList_s
 	int gender;
 	int numVoiceChats;
 	voiceChat_t voiceChats[MAX_VOICECHATS];
+	int hash[VOICECHAT_HASHSIZE];		// voice chat + 1, 0 if empty
 }
 voiceChatList_t;
 
@@ -763,6 +777,40 @@ headModelVoiceChat_t;
 voiceChatList_t voiceChatLists[MAX_VOICEFILES];
 headModelVoiceChat_t headModelVoiceChat[MAX_HEADMODELS];
 
+/*
+=================
+CG_VoiceChatHash
+=================
+*/
+static int CG_VoiceChatHash(const char *id)
+{
+	unsigned int hash;
+
+	hash = 0;
+	while (*id)
+	{
+		hash = hash * 31 + tolower(*id++);
+	}
+	return hash & (VOICECHAT_HASHSIZE - 1);
+}
+
+/*
+=================
+CG_HashVoiceChat
+=================
+*/
+static void CG_HashVoiceChat(voiceChatList_t *voiceChatList, int num)
+{
+	int h;
+
+	h = CG_VoiceChatHash(voiceChatList->voiceChats[num].id);
+	while (voiceChatList->hash[h])
+	{
+		h = (h + 1) & (VOICECHAT_HASHSIZE - 1);
+	}
+	voiceChatList->hash[h] = num + 1;
+}
+
 /*
 =================
 CG_ParseVoiceChats
@@ -810,6 +858,7 @@ int CG_ParseVoiceChats(const char *filename, voiceChatList_t *voiceChatList, int
 	{
 		voiceChats[i].id[0] = 0;
 	}
+	memset(voiceChatList->hash, 0, sizeof(voiceChatList->hash));
 	token = COM_ParseExt(p, qtrue);
 	if (!token || token[0] == 0)
 	{
@@ -871,6 +920,7 @@ int CG_ParseVoiceChats(const char *filename, voiceChatList_t *voiceChatList, int
 			if (voiceChats[voiceChatList->numVoiceChats].numSounds >= MAX_VOICESOUNDS)
 				break;
 		}
+		CG_HashVoiceChat(voiceChatList, voiceChatList->numVoiceChats);
 		voiceChatList->numVoiceChats++;
 		if (voiceChatList->numVoiceChats >= maxVoiceChats)
 			return qtrue;
@@ -959,10 +1009,11 @@ CG_GetVoiceChat
 */
 int CG_GetVoiceChat(voiceChatList_t *voiceChatList, const char *id, sfxHandle_t *snd, char **chat)
 {
-	int i, rnd;
+	int h, i, rnd;
 
-	for (i = 0; i < voiceChatList->numVoiceChats; i++)
+	for (h = CG_VoiceChatHash(id); voiceChatList->hash[h]; h = (h + 1) & (VOICECHAT_HASHSIZE - 1))
 	{
+		i = voiceChatList->hash[h] - 1;
 		if (!Q_stricmp(id, voiceChatList->voiceChats[i].id))
 		{
 			rnd = random() * voiceChatList->voiceChats[i].numSounds;
@@ -976,21 +1027,14 @@ int CG_GetVoiceChat(voiceChatList_t *voiceChatList, const char *id, sfxHandle_t
 
 /*
 =================
-CG_VoiceChatListForClient
+CG_FindVoiceChatList
 =================
 */
-voiceChatList_t *CG_VoiceChatListForClient(int clientNum)
+static voiceChatList_t *CG_FindVoiceChatList(clientInfo_t *ci)
 {
-	clientInfo_t *ci;
 	int voiceChatNum, i, j, k, gender;
 	char filename[MAX_QPATH], headModelName[MAX_QPATH];
 
-	if (clientNum < 0 || clientNum >= MAX_CLIENTS)
-	{
-		clientNum = 0;
-	}
-	ci = &cgs.clientinfo[ clientNum ];
-
 	for (k = 0; k < 2; k++)
 	{
 		if (k == 0)
@@ -1088,6 +1132,30 @@ voiceChatList_t *CG_VoiceChatListForClient(int clientNum)
 	return &voiceChatLists[0];
 }
 
+/*
+=================
+CG_VoiceChatListForClient
+
+the list is looked up once per client info
+=================
+*/
+voiceChatList_t *CG_VoiceChatListForClient(int clientNum)
+{
+	clientInfo_t *ci;
+
+	if (clientNum < 0 || clientNum >= MAX_CLIENTS)
+	{
+		clientNum = 0;
+	}
+	ci = &cgs.clientinfo[ clientNum ];
+
+	if (!ci->voiceChatList)
+	{
+		ci->voiceChatList = CG_FindVoiceChatList(ci) - voiceChatLists + 1;
+	}
+	return &voiceChatLists[ci->voiceChatList - 1];
+}
+
 #define MAX_VOICECHATBUFFER		32
 
 typedef struct bufferedVoiceChat_s
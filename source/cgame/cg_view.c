@@ -1036,6 +1036,202 @@ static void CG_PlayBufferedSounds(void)
 
 //=========================================================================
 
+/*
+=============================================================================
+
+FRAME TIMING
+
+Every frame the phases of CG_DrawActiveFrame are timed into a ring of
+the last PERF_FRAMES frames, with how many things each of them had to
+go through. cg_drawPerf shows the averages and perfreport prints them
+with the worst frame of the ring. trap_Milliseconds only counts whole
+milliseconds, the averages are what is worth reading.
+
+=============================================================================
+*/
+
+perfStats_t	cg_perf;
+
+const char	*perfPhaseNames[PERF_NUM_PHASES] =
+{
+	"snapshots",
+	"predict",
+	"entities",
+	"marks",
+	"particles",
+	"localents",
+	"scene",
+	"draw2D",
+	"cgame"
+};
+
+static const char	*perfCountNames[PERFC_NUM_COUNTS] =
+{
+	"entities",
+	"pmoves",
+	"marks",
+	"particles",
+	"localents"
+};
+
+/*
+=================
+CG_PerfFrame
+
+Opens the ring slot of a new frame
+=================
+*/
+static void CG_PerfFrame(void)
+{
+	int		now, slot;
+
+	now = trap_Milliseconds();
+	cg_perf.frame++;
+	slot = cg_perf.frame % PERF_FRAMES;
+
+	memset(cg_perf.msec[slot], 0, sizeof(cg_perf.msec[slot]));
+	memset(cg_perf.counts[slot], 0, sizeof(cg_perf.counts[slot]));
+	cg_perf.interval[slot] = cg_perf.lastStart ? now - cg_perf.lastStart : 0;
+	cg_perf.lastStart = now;
+	cg_perf.start[PERF_CGAME] = now;
+}
+
+/*
+=================
+CG_PerfStart
+=================
+*/
+void CG_PerfStart(perfPhase_t phase)
+{
+	cg_perf.start[phase] = trap_Milliseconds();
+}
+
+/*
+=================
+CG_PerfStop
+=================
+*/
+void CG_PerfStop(perfPhase_t phase)
+{
+	cg_perf.msec[cg_perf.frame % PERF_FRAMES][phase] += trap_Milliseconds() - cg_perf.start[phase];
+}
+
+/*
+=================
+CG_PerfCount
+=================
+*/
+void CG_PerfCount(perfCount_t count, int n)
+{
+	cg_perf.counts[cg_perf.frame % PERF_FRAMES][count] += n;
+}
+
+/*
+=================
+CG_PerfSummary
+
+Averages and worsts of the frames done, the one running is left out
+=================
+*/
+void CG_PerfSummary(perfSummary_t *sum)
+{
+	int		i, j, slot, total;
+	int		msec[PERF_NUM_PHASES], counts[PERFC_NUM_COUNTS];
+
+	memset(sum, 0, sizeof(*sum));
+	memset(msec, 0, sizeof(msec));
+	memset(counts, 0, sizeof(counts));
+
+	sum->frames = cg_perf.frame - 1;
+	if (sum->frames > PERF_FRAMES - 1)
+	{
+		sum->frames = PERF_FRAMES - 1;
+	}
+	if (sum->frames <= 0)
+	{
+		sum->frames = 0;
+		return;
+	}
+
+	total = 0;
+	sum->worstFrame = (cg_perf.frame - 1) % PERF_FRAMES;
+	for (i = 1; i <= sum->frames; i++)
+	{
+		slot = (cg_perf.frame - i) % PERF_FRAMES;
+
+		for (j = 0; j < PERF_NUM_PHASES; j++)
+		{
+			msec[j] += cg_perf.msec[slot][j];
+			if (cg_perf.msec[slot][j] > sum->worst[j])
+			{
+				sum->worst[j] = cg_perf.msec[slot][j];
+			}
+		}
+		for (j = 0; j < PERFC_NUM_COUNTS; j++)
+		{
+			counts[j] += cg_perf.counts[slot][j];
+			if (cg_perf.counts[slot][j] > sum->countWorst[j])
+			{
+				sum->countWorst[j] = cg_perf.counts[slot][j];
+			}
+		}
+
+		total += cg_perf.interval[slot];
+		if (cg_perf.interval[slot] > cg_perf.interval[sum->worstFrame])
+		{
+			sum->worstFrame = slot;
+		}
+	}
+
+	for (j = 0; j < PERF_NUM_PHASES; j++)
+	{
+		sum->avg[j] = msec[j] * 10 / sum->frames;
+	}
+	for (j = 0; j < PERFC_NUM_COUNTS; j++)
+	{
+		sum->countAvg[j] = counts[j] / sum->frames;
+	}
+	sum->intervalAvg = total * 10 / sum->frames;
+}
+
+/*
+=================
+CG_PerfReport
+
+Prints the summary of the ring to the console, for bug reports
+=================
+*/
+void CG_PerfReport(void)
+{
+	perfSummary_t	sum;
+	int				i, slot;
+
+	CG_PerfSummary(&sum);
+	if (!sum.frames)
+	{
+		CG_Printf("no frames timed yet\n");
+		return;
+	}
+	slot = sum.worstFrame;
+
+	CG_Printf("last %i frames: %i.%i msec a frame, worst %i msec\n", sum.frames,
+		sum.intervalAvg / 10, sum.intervalAvg % 10, cg_perf.interval[slot]);
+	CG_Printf("%-10s %7s %6s %12s\n", "phase", "avg", "worst", "worst frame");
+	for (i = 0; i < PERF_NUM_PHASES; i++)
+	{
+		CG_Printf("%-10s %4i.%i %6i %12i\n", perfPhaseNames[i],
+			sum.avg[i] / 10, sum.avg[i] % 10, sum.worst[i], cg_perf.msec[slot][i]);
+	}
+	CG_Printf("%-10s %7s %6s %12s\n", "count", "avg", "worst", "worst frame");
+	for (i = 0; i < PERFC_NUM_COUNTS; i++)
+	{
+		CG_Printf("%-10s %7i %6i %12i\n", perfCountNames[i],
+			sum.countAvg[i], sum.countWorst[i], cg_perf.counts[slot][i]);
+	}
+}
+
+//=========================================================================
+
 /*
 =================
 CG_DrawActiveFrame
@@ -1062,6 +1258,8 @@ void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoP
 		return;
 	}
 
+	CG_PerfFrame();
+
 	// any looped sounds will be respecified as entities
 	// are added to the render list
 	trap_S_ClearLoopingSounds(qfalse);
@@ -1070,7 +1268,9 @@ void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoP
 	trap_R_ClearScene();
 
 	// set up cg.snap and possibly cg.nextSnap
+	CG_PerfStart(PERF_SNAPSHOTS);
 	CG_ProcessSnapshots();
+	CG_PerfStop(PERF_SNAPSHOTS);
 
 	// if we haven't received any snapshots yet, all
 	// we can draw is the information screen
@@ -1086,8 +1286,12 @@ void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoP
 	// this counter will be bumped for every valid scene we generate
 	cg.clientFrame++;
 
+	CG_PerfCount(PERFC_ENTITIES, cg.snap->numEntities);
+
 	// update cg.predictedPlayerState
+	CG_PerfStart(PERF_PREDICT);
 	CG_PredictPlayerState();
+	CG_PerfStop(PERF_PREDICT);
 
 	Back3dPerson = cg_thirdPerson.integer;
 
@@ -1159,10 +1363,20 @@ void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoP
 	// build the render lists
 	if (!cg.hyperspace)
 	{
+		CG_PerfStart(PERF_ENTITIES);
 		CG_AddPacketEntities();			// adter calcViewValues, so predicted player state is correct
+		CG_AddFlameStreams();
+		CG_PerfStop(PERF_ENTITIES);
+		CG_PerfStart(PERF_MARKS);
 		CG_AddMarks();
+		CG_PerfStop(PERF_MARKS);
+		CG_PerfStart(PERF_PARTICLES);
 		CG_AddParticles ();
+		CG_PerfStop(PERF_PARTICLES);
+		CG_PerfStart(PERF_LOCALENTS);
 		CG_AddLocalEntities();
+		CG_PerfStop(PERF_LOCALENTS);
+		CG_PerfCount(PERFC_LOCALENTS, cg_leStats.active);
 	}
 	CG_AddViewWeapon(&cg.predictedPlayerState);
 
@@ -1225,6 +1439,8 @@ void CG_DrawActiveFrame(int serverTime, stereoFrame_t stereoView, qboolean demoP
 		CG_Printf("cg.clientFrame:%i\n", cg.clientFrame);
 	}
 
+	CG_PerfStop(PERF_CGAME);
+
 
 }
 
@@ -1265,12 +1265,18 @@ void Inv_FlameTrail(centity_t *cent, vec3_t origin, qboolean Firing)
 
 	if (Firing)
 	{
-		if (cent->Flame[0] != -1 || cent->Flame[1] != -1)
+		vec3_t FlamePos;
+
+		if (cent->Flame[0] != -1 || cent->Flame[1] != -1
+			|| CG_FlameStreamOrigin(cent->currentState.number, FlamePos, 2))
 		{
-			vec3_t FlamePos;
 			changed = qtrue;
 
-			if (cent->Flame[0] == -1)
+			if (cent->Flame[0] == -1 && cent->Flame[1] == -1)
+			{
+				// flame stream, FlamePos is already set
+			}
+			else if (cent->Flame[0] == -1)
 			{
 				VectorCopy(cg_entities[cent->Flame[1]].lerpOrigin, FlamePos);
 			}
@@ -3057,6 +3063,36 @@ void CG_Bullet(vec3_t end, int sourceEntityNum, vec3_t normal, qboolean flesh, i
 
 }
 
+/*
+======================
+CG_BulletHits
+
+Renders the impacts of an EV_BULLET_HITS event
+======================
+*/
+void CG_BulletHits(entityState_t *es)
+{
+	vec3_t	dir;
+	int		i, bits;
+
+	for (i = 0; i < es->eventParm && i < MAX_BULLET_IMPACTS; i++)
+	{
+		bits = BG_BulletImpact(es, i);
+		if (bits & BULLET_IMPACT_FLESH)
+		{
+			VectorClear(dir);
+			CG_Bullet(BG_BulletImpactOrigin(es, i), es->otherEntityNum, dir, qtrue, bits & 255,
+				(bits & BULLET_IMPACT_TRACER) != 0);
+		}
+		else
+		{
+			ByteToDir(bits & 255, dir);
+			CG_Bullet(BG_BulletImpactOrigin(es, i), es->otherEntityNum, dir, qfalse, ENTITYNUM_WORLD,
+				(bits & BULLET_IMPACT_TRACER) != 0);
+		}
+	}
+}
+
 //Too :
 void CG_BackWeaponInit(centity_t *ent, int Time)
 {
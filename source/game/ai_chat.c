@@ -499,7 +499,7 @@ int BotChat_EnterGame(bot_state_t *bs)
 	if (TeamPlayIsOn()) return qfalse;
 	// don't chat in tournament mode
 	if (gametype == GT_TOURNAMENT) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_ENTEREXITGAME, 0, 1);
+	rnd = bs->chars.chat_enterexitgame;
 	if (!bot_fastchat.integer)
 	{
 		if (random() > rnd) return qfalse;
@@ -534,7 +534,7 @@ int BotChat_ExitGame(bot_state_t *bs)
 	if (TeamPlayIsOn()) return qfalse;
 	// don't chat in tournament mode
 	if (gametype == GT_TOURNAMENT) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_ENTEREXITGAME, 0, 1);
+	rnd = bs->chars.chat_enterexitgame;
 	if (!bot_fastchat.integer)
 	{
 		if (random() > rnd) return qfalse;
@@ -574,7 +574,7 @@ int BotChat_StartLevel(bot_state_t *bs)
 	}
 	// don't chat in tournament mode
 	if (gametype == GT_TOURNAMENT) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_STARTENDLEVEL, 0, 1);
+	rnd = bs->chars.chat_startendlevel;
 	if (!bot_fastchat.integer)
 	{
 		if (random() > rnd) return qfalse;
@@ -612,7 +612,7 @@ int BotChat_EndLevel(bot_state_t *bs)
 	}
 	// don't chat in tournament mode
 	if (gametype == GT_TOURNAMENT) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_STARTENDLEVEL, 0, 1);
+	rnd = bs->chars.chat_startendlevel;
 	if (!bot_fastchat.integer)
 	{
 		if (random() > rnd) return qfalse;
@@ -666,7 +666,7 @@ int BotChat_Death(bot_state_t *bs)
 
 	if (bot_nochat.integer) return qfalse;
 	if (bs->lastchat_time > FloatTime() - TIME_BETWEENCHATTING) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_DEATH, 0, 1);
+	rnd = bs->chars.chat_death;
 	// don't chat in tournament mode
 	if (gametype == GT_TOURNAMENT) return qfalse;
 	//if fast chatting is off
@@ -742,7 +742,7 @@ int BotChat_Death(bot_state_t *bs)
 							NULL);
 			}
 			//choose between insult and praise
-			else if (random() < trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_INSULT, 0, 1))
+			else if (random() < bs->chars.chat_insult)
 			{
 				BotAI_BotInitialChat(bs, "death_insult",
 							name,												// 0
@@ -775,7 +775,7 @@ int BotChat_Kill(bot_state_t *bs)
 
 	if (bot_nochat.integer) return qfalse;
 	if (bs->lastchat_time > FloatTime() - TIME_BETWEENCHATTING) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_KILL, 0, 1);
+	rnd = bs->chars.chat_kill;
 	// don't chat in tournament mode
 	if (gametype == GT_TOURNAMENT) return qfalse;
 	//if fast chat is off
@@ -823,7 +823,7 @@ int BotChat_Kill(bot_state_t *bs)
 			BotAI_BotInitialChat(bs, "kill_kamikaze", name, NULL);
 #endif
 		//choose between insult and praise
-		else if (random() < trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_INSULT, 0, 1))
+		else if (random() < bs->chars.chat_insult)
 		{
 			BotAI_BotInitialChat(bs, "kill_insult", name, NULL);
 		}
@@ -850,7 +850,7 @@ int BotChat_EnemySuicide(bot_state_t *bs)
 	if (bs->lastchat_time > FloatTime() - TIME_BETWEENCHATTING) return qfalse;
 	if (BotNumActivePlayers() <= 1) return qfalse;
 	//
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_KILL, 0, 1);
+	rnd = bs->chars.chat_kill;
 	//don't chat in teamplay
 	if (TeamPlayIsOn()) return qfalse;
 	// don't chat in tournament mode
@@ -892,7 +892,7 @@ int BotChat_HitTalking(bot_state_t *bs)
 	//
 	if (lasthurt_client < 0 || lasthurt_client >= MAX_CLIENTS) return qfalse;
 	//
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_HITTALKING, 0, 1);
+	rnd = bs->chars.chat_hittalking;
 	//don't chat in teamplay
 	if (TeamPlayIsOn()) return qfalse;
 	// don't chat in tournament mode
@@ -934,7 +934,7 @@ int BotChat_HitNoDeath(bot_state_t *bs)
 	if (bot_nochat.integer) return qfalse;
 	if (bs->lastchat_time > FloatTime() - TIME_BETWEENCHATTING) return qfalse;
 	if (BotNumActivePlayers() <= 1) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_HITNODEATH, 0, 1);
+	rnd = bs->chars.chat_hitnodeath;
 	//don't chat in teamplay
 	if (TeamPlayIsOn()) return qfalse;
 	// don't chat in tournament mode
@@ -974,7 +974,7 @@ int BotChat_HitNoKill(bot_state_t *bs)
 	if (bot_nochat.integer) return qfalse;
 	if (bs->lastchat_time > FloatTime() - TIME_BETWEENCHATTING) return qfalse;
 	if (BotNumActivePlayers() <= 1) return qfalse;
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_HITNOKILL, 0, 1);
+	rnd = bs->chars.chat_hitnokill;
 	//don't chat in teamplay
 	if (TeamPlayIsOn()) return qfalse;
 	// don't chat in tournament mode
@@ -1020,7 +1020,7 @@ int BotChat_Random(bot_state_t *bs)
 		bs->ltgtype == LTG_TEAMACCOMPANY ||
 		bs->ltgtype == LTG_RUSHBASE) return qfalse;
 	//
-	rnd = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_RANDOM, 0, 1);
+	rnd = bs->chars.chat_random;
 	if (random() > bs->thinktime * 0.1) return qfalse;
 	if (!bot_fastchat.integer)
 	{
@@ -1047,7 +1047,7 @@ int BotChat_Random(bot_state_t *bs)
 		return qfalse;			// don't wait
 	}
 	//
-	if (random() < trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_MISC, 0, 1))
+	if (random() < bs->chars.chat_misc)
 	{
 		BotAI_BotInitialChat(bs, "random_misc",
 					BotRandomOpponentName(bs),	// 0
@@ -1083,7 +1083,7 @@ float BotChatTime(bot_state_t *bs)
 {
 	int cpm;
 
-	cpm = trap_Characteristic_BInteger(bs->character, CHARACTERISTIC_CHAT_CPM, 1, 4000);
+	cpm = bs->chars.chat_cpm;
 
 	return 2.0;	//(float) trap_BotChatLength(bs->cs) * 30 / cpm;
 }
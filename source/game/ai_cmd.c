@@ -1988,7 +1988,7 @@ int BotMatchMessage(bot_state_t *bs, char *message)
 
 	match.type = 0;
 	//if it is an unknown message
-	if (!trap_BotFindMatch(message, &match, MTCONTEXT_MISC
+	if (!BotFindMatchCached(message, &match, MTCONTEXT_MISC
 											|MTCONTEXT_INITIALTEAMCHAT
 											|MTCONTEXT_CTF))
 											{
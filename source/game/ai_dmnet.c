@@ -502,7 +502,7 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 				//don't crouch if crouched less than 5 seconds ago
 				if (bs->attackcrouch_time < FloatTime() - 5)
 				{
-					croucher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CROUCHER, 0, 1);
+					croucher = bs->chars.croucher;
 					if (random() < bs->thinktime * croucher)
 					{
 						bs->attackcrouch_time = FloatTime() + 5 + croucher * 15;
@@ -808,7 +808,7 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 			//don't crouch if crouched less than 5 seconds ago
 			if (bs->attackcrouch_time < FloatTime() - 5)
 			{
-				croucher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CROUCHER, 0, 1);
+				croucher = bs->chars.croucher;
 				if (random() < bs->thinktime * croucher)
 				{
 					bs->attackcrouch_time = FloatTime() + 5 + croucher * 15;
@@ -2925,7 +2925,7 @@ int AINode_Battle_Retreat(bot_state_t *bs)
 	else if (!(moveresult.flags & MOVERESULT_MOVEMENTVIEWSET)
 				&& !(bs->flags & BFL_IDEALVIEWSET))
 	{
-		attack_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_ATTACK_SKILL, 0, 1);
+		attack_skill = bs->chars.attack_skill;
 		//if the bot is skilled anough
 		if (attack_skill > 0.3)
 		{
@@ -3099,7 +3099,7 @@ int AINode_Battle_NBG(bot_state_t *bs)
 	else if (!(moveresult.flags & MOVERESULT_MOVEMENTVIEWSET)
 				&& !(bs->flags & BFL_IDEALVIEWSET))
 				{
-		attack_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_ATTACK_SKILL, 0, 1);
+		attack_skill = bs->chars.attack_skill;
 		//if the bot is skilled anough and the enemy is visible
 		if (attack_skill > 0.3)
 		{
@@ -63,6 +63,7 @@ vmCvar_t bot_rocketjump;
 vmCvar_t bot_fastchat;
 vmCvar_t bot_nochat;
 vmCvar_t bot_testrchat;
+vmCvar_t bot_matchcachestats;
 vmCvar_t bot_challenge;
 vmCvar_t bot_predictobstacles;
 vmCvar_t g_spSkill;
@@ -3318,7 +3319,7 @@ int BotCanAndWantsToRocketJump(bot_state_t *bs)
 		//if the bot has insufficient armor
 		if (bs->inventory[INVENTORY_ARMOR] < 40) return qfalse;
 	}
-	rocketjumper = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_WEAPONJUMPING, 0, 1);
+	rocketjumper = bs->chars.weaponjumping;
 	if (rocketjumper < 0.5) return qfalse;
 	return qtrue;
 }
@@ -3392,7 +3393,7 @@ void BotGoCamp(bot_state_t *bs, bot_goal_t *goal)
 	//set the team goal
 	memcpy(&bs->teamgoal, goal, sizeof(bot_goal_t));
 	//get the team goal time
-	camper = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CAMPER, 0, 1);
+	camper = bs->chars.camper;
 	if (camper > 0.99) bs->teamgoal_time = FloatTime() + 99999;
 	else bs->teamgoal_time = FloatTime() + 120 + 180 * camper + random() * 15;
 	//set the last time the bot started camping
@@ -3417,7 +3418,7 @@ int BotWantsToCamp(bot_state_t *bs)
 	if (gametype == GT_INVASION || gametype == GT_DESTROY)
 		return qfalse;
 
-	camper = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CAMPER, 0, 1);
+	camper = bs->chars.camper;
 	if (camper < 0.1) return qfalse;
 	//if the bot has a team goal
 	if (bs->ltgtype == LTG_TEAMHELP ||
@@ -3610,13 +3611,13 @@ bot_moveresult_t BotAttackMove(bot_state_t *bs, int tfl)
 
 	memset(&moveresult, 0, sizeof(bot_moveresult_t));
 
-	attack_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_ATTACK_SKILL, 0, 1);
+	attack_skill = bs->chars.attack_skill;
 	if (EasyKill)
 		jumper = 0;
 	else
-		jumper = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_JUMPER, 0, 1);
+		jumper = bs->chars.jumper;
 
-	croucher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CROUCHER, 0, 1);
+	croucher = bs->chars.croucher;
 	//if the bot is really stupid
 	if (attack_skill < 0.2) return moveresult;
 	//initialize the movement state
@@ -4012,8 +4013,8 @@ int BotFindEnemy(bot_state_t *bs, int curenemy)
 		}
 	}
 
-	alertness = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_ALERTNESS, 0, 1);
-	easyfragger = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_EASY_FRAGGER, 0, 1);
+	alertness = bs->chars.alertness;
+	easyfragger = bs->chars.easy_fragger;
 	//check if the health decreased
 	healthdecrease = bs->lasthealth > bs->inventory[INVENTORY_HEALTH];
 	//remember the current health value
@@ -4511,13 +4512,13 @@ void BotAimAtEnemy(bot_state_t *bs)
 	//
 	//BotAI_Print(PRT_MESSAGE, "client %d: aiming at client %d\n", bs->entitynum, bs->enemy);
 	//
-	aim_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL, 0, 1);
-	aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY, 0, 1);
+	aim_skill = bs->chars.aim_skill;
+	aim_accuracy = bs->chars.aim_accuracy;
 	//
 	if (aim_skill > 0.95)
 	{
 		//don't aim too early
-		reactiontime = 0.5 * trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_REACTIONTIME, 0, 1);
+		reactiontime = 0.5 * bs->chars.reactiontime;
 		if (bs->enemysight_time > FloatTime() - reactiontime) return;
 		if (bs->teleport_time > FloatTime() - reactiontime) return;
 	}
@@ -4533,39 +4534,39 @@ void BotAimAtEnemy(bot_state_t *bs)
 	//get the weapon specific aim accuracy and or aim skill
 	if (wi.number == WP_MACHINEGUN || wi.number == WP_INVCHAINGUN)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_MACHINEGUN, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_machinegun;
 	}
 	else if (wi.number == WP_SHOTGUN)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_SHOTGUN, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_shotgun;
 	}
 	else if (wi.number == WP_GRENADE_LAUNCHER)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_GRENADELAUNCHER, 0, 1);
-		aim_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_GRENADELAUNCHER, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_grenadelauncher;
+		aim_skill = bs->chars.aim_skill_grenadelauncher;
 	}
 	else if (wi.number == WP_ROCKET_LAUNCHER)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_ROCKETLAUNCHER, 0, 1);
-		aim_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_ROCKETLAUNCHER, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_rocketlauncher;
+		aim_skill = bs->chars.aim_skill_rocketlauncher;
 	}
 	else if (wi.number == WP_LIGHTNING)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_LIGHTNING, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_lightning;
 	}
 	else if (wi.number == WP_RAILGUN)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_RAILGUN, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_railgun;
 	}
 	else if (wi.number == WP_PLASMAGUN || wi.number == WP_FLAMETHROWER)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_PLASMAGUN, 0, 1);
-		aim_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_PLASMAGUN, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_plasmagun;
+		aim_skill = bs->chars.aim_skill_plasmagun;
 	}
 	else if (wi.number == WP_BFG)
 	{
-		aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_BFG10K, 0, 1);
-		aim_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_BFG10K, 0, 1);
+		aim_accuracy = bs->chars.aim_accuracy_bfg10k;
+		aim_skill = bs->chars.aim_skill_bfg10k;
 	}
 	//
 	if (aim_accuracy <= 0) aim_accuracy = 0.0001f;
@@ -4861,14 +4862,14 @@ void BotCheckAttack(bot_state_t *bs)
 		}
 	}
 	//
-	reactiontime = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_REACTIONTIME, 0, 1);
+	reactiontime = bs->chars.reactiontime;
 	if (bs->enemysight_time > FloatTime() - reactiontime) return;
 	if (bs->teleport_time > FloatTime() - reactiontime) return;
 	//if changing weapons
 	if (bs->weaponchange_time > FloatTime() - 0.1) return;
 	//check fire throttle characteristic
 	if (bs->firethrottlewait_time > FloatTime()) return;
-	firethrottle = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_FIRETHROTTLE, 0, 1);
+	firethrottle = bs->chars.firethrottle;
 	if (bs->firethrottleshoot_time < FloatTime())
 	{
 		firethrottle += (1 - firethrottle) * 0.5f;		//Too:
@@ -5082,7 +5083,7 @@ void BotMapScripts(bot_state_t *bs)
 			bs->flags |= BFL_IDEALVIEWSET;
 			VectorSubtract(buttonorg, bs->eye, dir);
 			vectoangles(dir, bs->ideal_viewangles);
-			aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY, 0, 1);
+			aim_accuracy = bs->chars.aim_accuracy;
 			bs->ideal_viewangles[PITCH] += 8 * crandom() * (1 - aim_accuracy);
 			bs->ideal_viewangles[PITCH] = AngleMod(bs->ideal_viewangles[PITCH]);
 			bs->ideal_viewangles[YAW] += 8 * crandom() * (1 - aim_accuracy);
@@ -6056,6 +6057,119 @@ int BotAIPredictObstacles(bot_state_t *bs, bot_goal_t *goal)
 	return qfalse;
 }
 
+/*
+==================
+Console message match cache
+
+All bots get the same console messages, and they used to run the same
+match templates over them one bot after the other.  Matches and the
+cleaned up message text are kept for the rest of the frame, keyed by
+the text and the match context.
+==================
+*/
+#define MATCHCACHE_SIZE		64		//must be a power of two
+
+typedef struct bot_matchcache_s
+{
+	int time;								//level.time the entry is valid for, 0 if unused
+	unsigned long context;
+	int found;								//BotFindMatch result, or -1 for a prepared message
+	char text[MAX_MESSAGE_SIZE];			//the message as it came in
+	bot_match_t match;						//the match, or the prepared text in match.string
+} bot_matchcache_t;
+
+static bot_matchcache_t matchcache[MATCHCACHE_SIZE];
+static int matchcachehits, matchcachemisses;
+static int matchcachestatstime;
+
+/*
+==================
+BotMatchCacheEntry
+==================
+*/
+static bot_matchcache_t *BotMatchCacheEntry(char *str, unsigned long context, int prepared, qboolean *hit)
+{
+	bot_matchcache_t *entry;
+	unsigned int hash;
+	char *p;
+
+	hash = 2166136261u ^ context ^ (prepared ? 0x9e3779b9u : 0);
+	for (p = str; *p; p++)
+	{
+		hash = (hash ^ (unsigned char) *p) * 16777619u;
+	}
+	entry = &matchcache[hash & (MATCHCACHE_SIZE-1)];
+	//
+	*hit = (entry->time == level.time && entry->context == context
+			&& (entry->found < 0) == (prepared != 0) && !strcmp(entry->text, str));
+	if (*hit) matchcachehits++;
+	else matchcachemisses++;
+	//
+	if (bot_matchcachestats.integer > 0 && level.time >= matchcachestatstime)
+	{
+		matchcachestatstime = level.time + bot_matchcachestats.integer * 1000;
+		if (matchcachehits + matchcachemisses)
+		{
+			BotAI_Print(PRT_MESSAGE, "match cache: %d lookups, %d%% hits\n",
+				matchcachehits + matchcachemisses, matchcachehits * 100 / (matchcachehits + matchcachemisses));
+		}
+		matchcachehits = matchcachemisses = 0;
+	}
+	return entry;
+}
+
+/*
+==================
+BotFindMatchCached
+
+trap_BotFindMatch for messages every bot looks at
+==================
+*/
+int BotFindMatchCached(char *str, bot_match_t *match, unsigned long context)
+{
+	bot_matchcache_t *entry;
+	qboolean hit;
+
+	entry = BotMatchCacheEntry(str, context, qfalse, &hit);
+	if (!hit)
+	{
+		entry->found = trap_BotFindMatch(str, &entry->match, context) != 0;
+		entry->time = level.time;
+		entry->context = context;
+		Q_strncpyz(entry->text, str, sizeof(entry->text));
+	}
+	memcpy(match, &entry->match, sizeof(bot_match_t));
+	return entry->found;
+}
+
+/*
+==================
+BotPrepareConsoleMessage
+
+unifies the white spaces and replaces the synonyms of the context in
+place, like every bot does with a message before matching it
+==================
+*/
+static void BotPrepareConsoleMessage(char *ptr, int context)
+{
+	bot_matchcache_t *entry;
+	qboolean hit;
+
+	entry = BotMatchCacheEntry(ptr, context, qtrue, &hit);
+	if (!hit)
+	{
+		Q_strncpyz(entry->text, ptr, sizeof(entry->text));
+		trap_UnifyWhiteSpaces(ptr);
+		trap_BotReplaceSynonyms(ptr, context);
+		Q_strncpyz(entry->match.string, ptr, sizeof(entry->match.string));
+		entry->found = -1;
+		entry->time = level.time;
+		entry->context = context;
+		return;
+	}
+	strcpy(ptr, entry->match.string);
+}
+
 /*
 ==================
 BotCheckConsoleMessages
@@ -6087,16 +6201,15 @@ void BotCheckConsoleMessages(bot_state_t *bs)
 		if (m.type == CMS_CHAT)
 		{
 			//
-			if (trap_BotFindMatch(m.message, &match, MTCONTEXT_REPLYCHAT))
+			if (BotFindMatchCached(m.message, &match, MTCONTEXT_REPLYCHAT))
 			{
 				ptr = m.message + match.variables[MESSAGE].offset;
 			}
 		}
-		//unify the white spaces in the message
-		trap_UnifyWhiteSpaces(ptr);
+		//unify the white spaces in the message and
 		//replace synonyms in the right context
 		context = BotSynonymContext(bs);
-		trap_BotReplaceSynonyms(ptr, context);
+		BotPrepareConsoleMessage(ptr, context);
 		//if there's no match
 		if (!BotMatchMessage(bs, m.message))
 		{
@@ -6104,7 +6217,7 @@ void BotCheckConsoleMessages(bot_state_t *bs)
 			if (m.type == CMS_CHAT && !bot_nochat.integer)
 			{
 				//
-				if (!trap_BotFindMatch(m.message, &match, MTCONTEXT_REPLYCHAT))
+				if (!BotFindMatchCached(m.message, &match, MTCONTEXT_REPLYCHAT))
 				{
 					trap_BotRemoveConsoleMessage(bs->cs, handle);
 					continue;
@@ -6149,7 +6262,7 @@ void BotCheckConsoleMessages(bot_state_t *bs)
 				//if at a valid chat position and not chatting already and not in teamplay
 				else if (bs->ainode != AINode_Stand && BotValidChatPosition(bs) && !TeamPlayIsOn())
 				{
-					chat_reply = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_REPLY, 0, 1);
+					chat_reply = bs->chars.chat_reply;
 					if (random() < 1.5 / (NumBots()+1) && random() < chat_reply)
 					{
 						//if bot replies with a chat message
@@ -7064,6 +7177,7 @@ void BotSetupDeathmatchAI(void)
 	trap_Cvar_Register(&bot_fastchat, "bot_fastchat", "0", 0);
 	trap_Cvar_Register(&bot_nochat, "bot_nochat", "0", 0);
 	trap_Cvar_Register(&bot_testrchat, "bot_testrchat", "0", 0);
+	trap_Cvar_Register(&bot_matchcachestats, "bot_matchcachestats", "0", 0);
 	trap_Cvar_Register(&bot_challenge, "bot_challenge", "0", 0);
 	trap_Cvar_Register(&bot_predictobstacles, "bot_predictobstacles", "1", 0);
 	trap_Cvar_Register(&g_spSkill, "g_spSkill", "2", 0);
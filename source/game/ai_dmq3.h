@@ -62,6 +62,8 @@ char *EasyClientName(int client, char *name, int size);
 char *ClientSkin(int client, char *skin, int size);
 // returns the appropriate synonym context for the current game type and situation
 int BotSynonymContext(bot_state_t *bs);
+// trap_BotFindMatch with the result shared by all bots for the current frame
+int BotFindMatchCached(char *str, bot_match_t *match, unsigned long context);
 // set last ordered task
 int BotSetLastOrderedTask(bot_state_t *bs);
 // selection of goals for teamplay
@@ -184,6 +186,7 @@ extern vmCvar_t bot_rocketjump;
 extern vmCvar_t bot_fastchat;
 extern vmCvar_t bot_nochat;
 extern vmCvar_t bot_testrchat;
+extern vmCvar_t bot_matchcachestats;
 extern vmCvar_t bot_challenge;
 
 extern bot_goal_t ctf_redflag;
@@ -860,8 +860,8 @@ void BotChangeViewAngles(bot_state_t *bs, float thinktime)
 	//
 	if (bs->enemy >= 0)
 	{
-		factor = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_VIEW_FACTOR, 0.01f, 1);
-		maxchange = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_VIEW_MAXCHANGE, 1, 1800);
+		factor = bs->chars.view_factor;
+		maxchange = bs->chars.view_maxchange;
 	}
 	else
 	{
@@ -1173,6 +1173,22 @@ int BotAI(int client, float thinktime)
 	return qtrue;
 }
 
+/*
+==================
+BotThinkTime
+
+bot_thinktime, or longer while the frame budget has the bots think less
+==================
+*/
+static int BotThinkTime(void)
+{
+	if (G_BotLoadThinkTime() > bot_thinktime.integer)
+	{
+		return G_BotLoadThinkTime();
+	}
+	return bot_thinktime.integer;
+}
+
 /*
 ==================
 BotScheduleBotThink
@@ -1191,7 +1207,7 @@ void BotScheduleBotThink(void)
 			continue;
 		}
 		//initialize the bot think residual time
-		botstates[i]->botthink_residual = bot_thinktime.integer * botnum / numbots;
+		botstates[i]->botthink_residual = BotThinkTime() * botnum / numbots;
 		botnum++;
 	}
 }
@@ -1355,7 +1371,8 @@ int BotAISetupClient(int client, struct bot_settings_s *settings, qboolean resta
 	bs->setupcount = 4;
 	bs->entergame_time = FloatTime();
 	bs->ms = trap_BotAllocMoveState();
-	bs->walker = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_WALKER, 0, 1);
+	BotLoadCharacteristics(bs);
+	bs->walker = bs->chars.walker;
 	numbots++;
 
 	if (trap_Cvar_VariableIntegerValue("bot_testichat"))
@@ -1429,6 +1446,59 @@ int BotAIShutdownClient(int client, qboolean restart)
 	return qtrue;
 }
 
+/*
+==============
+BotLoadCharacteristics
+
+reads the characteristics used while thinking when the character is
+loaded, instead of asking the botlib for them on every think
+==============
+*/
+void BotLoadCharacteristics(bot_state_t *bs)
+{
+	bot_characteristics_t *c = &bs->chars;
+
+	c->attack_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_ATTACK_SKILL, 0, 1);
+	c->view_factor = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_VIEW_FACTOR, 0.01f, 1);
+	c->view_maxchange = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_VIEW_MAXCHANGE, 1, 1800);
+	c->reactiontime = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_REACTIONTIME, 0, 1);
+	c->aim_accuracy = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY, 0, 1);
+	c->aim_accuracy_machinegun = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_MACHINEGUN, 0, 1);
+	c->aim_accuracy_shotgun = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_SHOTGUN, 0, 1);
+	c->aim_accuracy_rocketlauncher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_ROCKETLAUNCHER, 0, 1);
+	c->aim_accuracy_grenadelauncher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_GRENADELAUNCHER, 0, 1);
+	c->aim_accuracy_lightning = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_LIGHTNING, 0, 1);
+	c->aim_accuracy_plasmagun = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_PLASMAGUN, 0, 1);
+	c->aim_accuracy_railgun = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_RAILGUN, 0, 1);
+	c->aim_accuracy_bfg10k = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_ACCURACY_BFG10K, 0, 1);
+	c->aim_skill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL, 0, 1);
+	c->aim_skill_rocketlauncher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_ROCKETLAUNCHER, 0, 1);
+	c->aim_skill_grenadelauncher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_GRENADELAUNCHER, 0, 1);
+	c->aim_skill_plasmagun = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_PLASMAGUN, 0, 1);
+	c->aim_skill_bfg10k = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_AIM_SKILL_BFG10K, 0, 1);
+	c->chat_cpm = trap_Characteristic_BInteger(bs->character, CHARACTERISTIC_CHAT_CPM, 1, 4000);
+	c->chat_insult = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_INSULT, 0, 1);
+	c->chat_misc = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_MISC, 0, 1);
+	c->chat_startendlevel = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_STARTENDLEVEL, 0, 1);
+	c->chat_enterexitgame = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_ENTEREXITGAME, 0, 1);
+	c->chat_kill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_KILL, 0, 1);
+	c->chat_death = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_DEATH, 0, 1);
+	c->chat_hittalking = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_HITTALKING, 0, 1);
+	c->chat_hitnodeath = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_HITNODEATH, 0, 1);
+	c->chat_hitnokill = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_HITNOKILL, 0, 1);
+	c->chat_random = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_RANDOM, 0, 1);
+	c->chat_reply = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CHAT_REPLY, 0, 1);
+	c->croucher = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CROUCHER, 0, 1);
+	c->jumper = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_JUMPER, 0, 1);
+	c->weaponjumping = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_WEAPONJUMPING, 0, 1);
+	c->camper = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_CAMPER, 0, 1);
+	c->easy_fragger = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_EASY_FRAGGER, 0, 1);
+	c->alertness = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_ALERTNESS, 0, 1);
+	c->firethrottle = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_FIRETHROTTLE, 0, 1);
+	c->walker = trap_Characteristic_BFloat(bs->character, CHARACTERISTIC_WALKER, 0, 1);
+}
+
+
 /*
 ==============
 BotResetState
@@ -1443,6 +1513,7 @@ void BotResetState(bot_state_t *bs)
 	int movestate, goalstate, chatstate, weaponstate;
 	bot_settings_t settings;
 	int character;
+	bot_characteristics_t chars;
 	playerState_t ps;							//current player state
 	float entergame_time;
 
@@ -1453,6 +1524,7 @@ void BotResetState(bot_state_t *bs)
 	client = bs->client;
 	entitynum = bs->entitynum;
 	character = bs->character;
+	memcpy(&chars, &bs->chars, sizeof(bot_characteristics_t));
 	movestate = bs->ms;
 	goalstate = bs->gs;
 	chatstate = bs->cs;
@@ -1474,6 +1546,7 @@ void BotResetState(bot_state_t *bs)
 	bs->client = client;
 	bs->entitynum = entitynum;
 	bs->character = character;
+	memcpy(&bs->chars, &chars, sizeof(bot_characteristics_t));
 	bs->entergame_time = entergame_time;
 	//reset several states
 	if (bs->ms) trap_BotResetMoveState(bs->ms);
@@ -1527,23 +1600,30 @@ int BotAIStartFrame(int time)
 	int i;
 	gentity_t	*ent;
 	bot_entitystate_t state;
-	int elapsed_time, thinktime;
+	int elapsed_time, thinktime, botthink_time;
 	static int local_time;
 	static int botlib_residual;
 	static int lastbotthink_time;
+	static int lastcvar_time;
 
 	G_CheckBotSpawn();
 
-	trap_Cvar_Update(&bot_rocketjump);
-	trap_Cvar_Update(&bot_grapple);
-	trap_Cvar_Update(&bot_fastchat);
-	trap_Cvar_Update(&bot_nochat);
-	trap_Cvar_Update(&bot_testrchat);
-	trap_Cvar_Update(&bot_thinktime);
-	trap_Cvar_Update(&bot_memorydump);
-	trap_Cvar_Update(&bot_saveroutingcache);
-	trap_Cvar_Update(&bot_pause);
-	trap_Cvar_Update(&bot_report);
+	//the bot cvars are looked at once a second
+	if (time - lastcvar_time >= 1000 || time < lastcvar_time)
+	{
+		lastcvar_time = time;
+		trap_Cvar_Update(&bot_rocketjump);
+		trap_Cvar_Update(&bot_grapple);
+		trap_Cvar_Update(&bot_fastchat);
+		trap_Cvar_Update(&bot_nochat);
+		trap_Cvar_Update(&bot_testrchat);
+		trap_Cvar_Update(&bot_matchcachestats);
+		trap_Cvar_Update(&bot_thinktime);
+		trap_Cvar_Update(&bot_memorydump);
+		trap_Cvar_Update(&bot_saveroutingcache);
+		trap_Cvar_Update(&bot_pause);
+		trap_Cvar_Update(&bot_report);
+	}
 
 	if (bot_report.integer)
 	{
@@ -1579,11 +1659,13 @@ int BotAIStartFrame(int time)
 	{
 		trap_BotLibVarSet("memorydump", "1");
 		trap_Cvar_Set("bot_memorydump", "0");
+		trap_Cvar_Update(&bot_memorydump);
 	}
 	if (bot_saveroutingcache.integer)
 	{
 		trap_BotLibVarSet("saveroutingcache", "1");
 		trap_Cvar_Set("bot_saveroutingcache", "0");
+		trap_Cvar_Update(&bot_saveroutingcache);
 	}
 	//check if bot interbreeding is activated
 	BotInterbreeding();
@@ -1591,11 +1673,13 @@ int BotAIStartFrame(int time)
 	if (bot_thinktime.integer > 200)
 	{
 		trap_Cvar_Set("bot_thinktime", "200");
+		trap_Cvar_Update(&bot_thinktime);
 	}
 	//if the bot think time changed we should reschedule the bots
-	if (bot_thinktime.integer != lastbotthink_time)
+	botthink_time = BotThinkTime();
+	if (botthink_time != lastbotthink_time)
 	{
-		lastbotthink_time = bot_thinktime.integer;
+		lastbotthink_time = botthink_time;
 		BotScheduleBotThink();
 	}
 
@@ -1604,8 +1688,8 @@ int BotAIStartFrame(int time)
 
 	botlib_residual += elapsed_time;
 
-	if (elapsed_time > bot_thinktime.integer) thinktime = elapsed_time;
-	else thinktime = bot_thinktime.integer;
+	if (elapsed_time > botthink_time) thinktime = elapsed_time;
+	else thinktime = botthink_time;
 
 	// update the bot library
 	if (botlib_residual >= thinktime)
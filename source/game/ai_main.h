@@ -106,6 +106,50 @@ typedef struct bot_activategoal_s
 }
 bot_activategoal_t;
 
+//characteristics the bot reads while thinking, see BotLoadCharacteristics
+typedef struct bot_characteristics_s
+{
+	float attack_skill;
+	float view_factor;
+	float view_maxchange;
+	float reactiontime;
+	float aim_accuracy;
+	float aim_accuracy_machinegun;
+	float aim_accuracy_shotgun;
+	float aim_accuracy_rocketlauncher;
+	float aim_accuracy_grenadelauncher;
+	float aim_accuracy_lightning;
+	float aim_accuracy_plasmagun;
+	float aim_accuracy_railgun;
+	float aim_accuracy_bfg10k;
+	float aim_skill;
+	float aim_skill_rocketlauncher;
+	float aim_skill_grenadelauncher;
+	float aim_skill_plasmagun;
+	float aim_skill_bfg10k;
+	int chat_cpm;
+	float chat_insult;
+	float chat_misc;
+	float chat_startendlevel;
+	float chat_enterexitgame;
+	float chat_kill;
+	float chat_death;
+	float chat_hittalking;
+	float chat_hitnodeath;
+	float chat_hitnokill;
+	float chat_random;
+	float chat_reply;
+	float croucher;
+	float jumper;
+	float weaponjumping;
+	float camper;
+	float easy_fragger;
+	float alertness;
+	float firethrottle;
+	float walker;
+} bot_characteristics_t;
+
+
 //bot state
 typedef struct bot_state_s
 {
@@ -197,6 +241,7 @@ typedef struct bot_state_s
 	int numproxmines;
 	//
 	int character;									//the bot character
+	bot_characteristics_t chars;					//cached characteristics of the character
 	int ms;											//move state of the bot
 	int gs;											//goal state of the bot
 	int cs;											//chat state of the bot
@@ -270,6 +315,8 @@ bot_state_t;
 
 //resets the whole bot state
 void BotResetState(bot_state_t *bs);
+//caches the characteristics of the bot character
+void BotLoadCharacteristics(bot_state_t *bs);
 //returns the number of bots in the game
 int NumBots(void);
 //returns info about the entity
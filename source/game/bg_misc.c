@@ -1444,6 +1444,56 @@ void BG_EvaluateTrajectoryDelta(const trajectory_t *tr, int atTime, vec3_t resul
 	}
 }
 
+/*
+================
+BG_BulletImpactOrigin
+
+Where impact n of an EV_BULLET_HITS event is kept. The event itself is
+stationary, so the rest of its trajectory and vectors are free.
+================
+*/
+float *BG_BulletImpactOrigin(entityState_t *es, int n)
+{
+	switch (n)
+	{
+	case 0:
+		return es->pos.trBase;
+	case 1:
+		return es->origin2;
+	case 2:
+		return es->angles2;
+	case 3:
+		return es->apos.trBase;
+	case 4:
+		return es->pos.trDelta;
+	default:
+		return es->apos.trDelta;
+	}
+}
+
+/*
+================
+BG_BulletImpact
+
+The bits of impact n, three impacts to an int in time and time2
+================
+*/
+int BG_BulletImpact(const entityState_t *es, int n)
+{
+	int		word = (n < 3) ? es->time : es->time2;
+
+	return (word >> ((n % 3) * BULLET_IMPACT_BITS)) & ((1 << BULLET_IMPACT_BITS) - 1);
+}
+
+void BG_SetBulletImpact(entityState_t *es, int n, int bits)
+{
+	int		*word = (n < 3) ? &es->time : &es->time2;
+	int		shift = (n % 3) * BULLET_IMPACT_BITS;
+
+	*word = (*word & ~(((1 << BULLET_IMPACT_BITS) - 1) << shift))
+		| ((bits & ((1 << BULLET_IMPACT_BITS) - 1)) << shift);
+}
+
 char *eventnames[] =
 {
 	"EV_NONE",
@@ -1822,4 +1872,216 @@ void BG_PlayerStateToEntityStateExtraPolate(playerState_t *ps, entityState_t *s,
 	s->generic1 = ps->generic1;
 }
 
+/*
+===============================================================================
+
+ARENA AND BOT INFOS
+
+The .arena and .bot files are parsed the same way by game, ui and
+q3_ui. Each file is read into info strings once, then indexed into
+records with the fields the lookups need and a hash of their names, so
+nothing has to go through Info_ValueForKey on every entry again.
+
+===============================================================================
+*/
+
+/*
+===============
+BG_ParseInfos
+
+Reads the { key value ... } blocks of buf into info strings, allocated
+with alloc, with room left for a "num" key
+===============
+*/
+int BG_ParseInfos(char *buf, int max, char *infos[], void *(*alloc)(int size))
+{
+	char	*token;
+	int		count;
+	char	key[MAX_TOKEN_CHARS];
+	char	info[MAX_INFO_STRING];
+
+	count = 0;
+
+	while (1)
+	{
+		token = COM_Parse(&buf);
+		if (!token[0])
+		{
+			break;
+		}
+		if (strcmp(token, "{"))
+		{
+			Com_Printf("Missing { in info file\n");
+			break;
+		}
+
+		if (count == max)
+		{
+			Com_Printf("Max infos exceeded\n");
+			break;
+		}
+
+		info[0] = '\0';
+		while (1)
+		{
+			token = COM_ParseExt(&buf, qtrue);
+			if (!token[0])
+			{
+				Com_Printf("Unexpected end of info file\n");
+				break;
+			}
+			if (!strcmp(token, "}"))
+			{
+				break;
+			}
+			Q_strncpyz(key, token, sizeof(key));
+
+			token = COM_ParseExt(&buf, qfalse);
+			if (!token[0])
+			{
+				strcpy(token, "<NULL>");
+			}
+			Info_SetValueForKey(info, key, token);
+		}
+		//NOTE: extra space for arena number
+		infos[count] = alloc(strlen(info) + strlen("\\num\\") + strlen(va("%d", MAX_ARENAS)) + 1);
+		if (infos[count])
+		{
+			strcpy(infos[count], info);
+			count++;
+		}
+	}
+	return count;
+}
+
+/*
+===============
+BG_ArenaGametypes
+
+The gametype_t bits of the "type" of an arena, ffa when it has none
+===============
+*/
+int BG_ArenaGametypes(const char *type)
+{
+	int		bits;
+
+	if (!*type)
+	{
+		return 1 << GT_FFA;
+	}
+
+	bits = 0;
+	if (strstr(type, "ffa"))
+	{
+		bits |= 1 << GT_FFA;
+	}
+	if (strstr(type, "tourney"))
+	{
+		bits |= 1 << GT_TOURNAMENT;
+	}
+	if (strstr(type, "ctf"))
+	{
+		bits |= 1 << GT_CTF;
+	}
+	if (strstr(type, "inv"))
+	{
+		bits |= (1 << GT_INVASION) | (1 << GT_DESTROY);
+	}
+	if (strstr(type, "tte"))
+	{
+		bits |= 1 << GT_INVASION;
+	}
+	if (strstr(type, "dae"))
+	{
+		bits |= 1 << GT_DESTROY;
+	}
+	return bits;
+}
+
+/*
+===============
+BG_InfoHash
+===============
+*/
+static int BG_InfoHash(const char *name)
+{
+	unsigned int hash;
+
+	hash = 0;
+	while (*name)
+	{
+		hash = hash * 31 + tolower(*name++);
+	}
+	return hash & (INFO_HASH_SIZE - 1);
+}
+
+/*
+===============
+BG_IndexInfos
+
+Fills table with a record for each of the numInfos infos, named by
+their nameKey. The first of several infos with the same name is the
+one found, as with the linear lookups this replaces.
+===============
+*/
+void BG_IndexInfos(infoTable_t *table, infoRecord_t *records, char *infos[], int numInfos,
+				   const char *nameKey)
+{
+	infoRecord_t	*rec, *last;
+	int				i, h;
+
+	table->records = records;
+	table->numRecords = numInfos;
+	for (h = 0; h < INFO_HASH_SIZE; h++)
+	{
+		table->hash[h] = -1;
+	}
+
+	for (i = 0, rec = records; i < numInfos; i++, rec++)
+	{
+		rec->info = infos[i];
+		Q_strncpyz(rec->name, Info_ValueForKey(infos[i], nameKey), sizeof(rec->name));
+		rec->hashNext = -1;
+
+		// append, so the first of the same name stays in front
+		h = BG_InfoHash(rec->name);
+		if (table->hash[h] == -1)
+		{
+			table->hash[h] = i;
+			continue;
+		}
+		for (last = &records[table->hash[h]]; last->hashNext != -1; last = &records[last->hashNext])
+			;
+		last->hashNext = i;
+	}
+}
+
+/*
+===============
+BG_FindInfo
+
+The record named name, whatever its case, or NULL
+===============
+*/
+infoRecord_t *BG_FindInfo(const infoTable_t *table, const char *name)
+{
+	int				i;
+	infoRecord_t	*rec;
+
+	if (!table->records)
+	{
+		return NULL;
+	}
+
+	for (i = table->hash[BG_InfoHash(name)]; i != -1; i = rec->hashNext)
+	{
+		rec = &table->records[i];
+		if (!Q_stricmp(rec->name, name))
+		{
+			return rec;
+		}
+	}
+	return NULL;
+}
+
 /*==================== EOF because of buggy VSS ===========*/
\ No newline at end of file
@@ -50,6 +50,23 @@ static int JumpTime = 0;
 qboolean WallWalk = qfalse;
 vec3_t Gravity;
 
+// trace memo, only valid for the current PmoveSingle
+#define	PM_TRACE_MEMO		8
+
+typedef struct
+{
+	vec3_t		start, end;
+	vec3_t		mins, maxs;
+	int			passEntityNum;
+	int			contentMask;
+	trace_t		trace;
+}
+pmTraceMemo_t;
+
+static pmTraceMemo_t	pm_traceMemo[PM_TRACE_MEMO];
+static int				pm_numTraceMemo;
+static int				pm_nextTraceMemo;
+
 static qboolean Inv_ApplyNewGround(vec3_t Normal, qboolean AdvanceOnNewGround);
 
 /*
@@ -764,6 +781,67 @@ void PM_AddTouchEnt(int entityNum)
 	pm->numtouch++;
 }
 
+/*
+===============
+PM_Trace
+
+All the move traces go through here so they can be counted.
+Nothing but the moving player changes during a PmoveSingle, and it
+is always the passEntityNum, so an identical query (wall walking
+asks the same ground and duck boxes several times) is answered from
+the memo instead of going back to the world
+===============
+*/
+void PM_Trace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentMask)
+{
+	pmTraceMemo_t	*memo;
+	int				i;
+
+	if (!mins)
+	{
+		mins = vec3_origin;
+	}
+	if (!maxs)
+	{
+		maxs = vec3_origin;
+	}
+
+	pm->numTraces++;
+
+	for (i = 0, memo = pm_traceMemo; i < pm_numTraceMemo; i++, memo++)
+	{
+		if (memo->passEntityNum == passEntityNum
+			&& memo->contentMask == contentMask
+			&& VectorCompare(memo->start, start)
+			&& VectorCompare(memo->end, end)
+			&& VectorCompare(memo->mins, mins)
+			&& VectorCompare(memo->maxs, maxs))
+		{
+			pm->numTraceMemoHits++;
+			*results = memo->trace;
+			return;
+		}
+	}
+
+	pm->trace(results, start, (float *)mins, (float *)maxs, end, passEntityNum, contentMask);
+
+	// the oldest entry goes first once the memo is full
+	memo = &pm_traceMemo[pm_nextTraceMemo];
+	pm_nextTraceMemo = (pm_nextTraceMemo + 1) % PM_TRACE_MEMO;
+	if (pm_numTraceMemo < PM_TRACE_MEMO)
+	{
+		pm_numTraceMemo++;
+	}
+
+	VectorCopy(start, memo->start);
+	VectorCopy(end, memo->end);
+	VectorCopy(mins, memo->mins);
+	VectorCopy(maxs, memo->maxs);
+	memo->passEntityNum = passEntityNum;
+	memo->contentMask = contentMask;
+	memo->trace = *results;
+}
+
 /*
 ===================
 PM_StartTorsoAnim
@@ -1313,7 +1391,7 @@ static void CheckLadder(void)
 	flatforward[2] = 0;
 	VectorNormalize(flatforward);
 	VectorMA(pm->ps->origin, 1, flatforward, spot);
-	pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, spot,
+	PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, spot,
 					pm->ps->clientNum, MASK_PLAYERSOLID);
 
 	if ((trace.fraction < 1) && (trace.surfaceFlags & SURF_LADDER))
@@ -1323,7 +1401,7 @@ static void CheckLadder(void)
 	else
 	{
 		VectorMA(pm->ps->origin, -1, flatforward, spot);
-		pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, spot,
+		PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, spot,
 					pm->ps->clientNum, MASK_PLAYERSOLID);
 
 		if ((trace.fraction < 1) && (trace.surfaceFlags & SURF_LADDER))
@@ -2136,7 +2214,7 @@ void PM_CheckStuck(void)
 {
 	trace_t trace;
 
-	pm->trace (&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
+	PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
 	if (trace.allsolid)
 	{
 		//int shit = qtrue;
@@ -2170,7 +2248,7 @@ static int PM_CorrectAllSolid(trace_t *trace)
 				point[0] += (float) i;
 				point[1] += (float) j;
 				point[2] += (float) k;
-				pm->trace (trace, point, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
+				PM_Trace(trace, point, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
 				if (!trace->allsolid)
 				{
 					VectorCopy(point, pm->ps->origin);		//Too: check if it's correct ..?
@@ -2178,7 +2256,7 @@ static int PM_CorrectAllSolid(trace_t *trace)
 					for (l = 0; l < 3; ++l)
 						point[l] = pm->ps->origin[l] + 0.25f * Gravity[l];
 
-					pm->trace (trace, pm->ps->origin, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
+					PM_Trace(trace, pm->ps->origin, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
 					pml.groundTrace = *trace;
 
 					assert(!trace->allsolid);
@@ -2231,7 +2309,7 @@ static void PM_GroundTraceMissed(void)
 		for (i = 0; i < 3; ++i)
 			point[i] += 64 * Gravity[i];
 
-		pm->trace (&trace, pm->ps->origin, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
+		PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
 		if (trace.fraction == 1.0)
 		{
 			if (pm->cmd.forwardmove >= 0)
@@ -2327,7 +2405,7 @@ static qboolean PM_CheckDuck(qboolean PutOnGround, vec3_t NewGravity)
 		{
 			// try to stand up
 			pm->maxs[2] = 32;
-			pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
+			PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
 			if (!trace.allsolid)
 				pm->ps->pm_flags &= ~PMF_DUCKED;
 		}
@@ -2392,7 +2470,7 @@ static qboolean PM_CheckDuck(qboolean PutOnGround, vec3_t NewGravity)
 			}
 		}
 
-		pm->trace(&trace, pm->ps->origin, NewMins, NewMaxs, pm->ps->origin,
+		PM_Trace(&trace, pm->ps->origin, NewMins, NewMaxs, pm->ps->origin,
 								pm->ps->clientNum, pm->tracemask);
 		if (trace.allsolid)
 		{
@@ -2401,7 +2479,7 @@ static qboolean PM_CheckDuck(qboolean PutOnGround, vec3_t NewGravity)
 			for (i = 0; i < 3; ++i)
 				Point[i] = pm->ps->origin[i] + Grav[i] * (13 + MINS_Z);
 
-			pm->trace(&trace, Point, NewMins, NewMaxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
+			PM_Trace(&trace, Point, NewMins, NewMaxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
 
 			if (trace.allsolid)
 			{
@@ -2411,7 +2489,7 @@ static qboolean PM_CheckDuck(qboolean PutOnGround, vec3_t NewGravity)
 					NewMaxs[i] = -MINS_Z;
 				}
 
-				pm->trace(&trace, pm->ps->origin, NewMins, NewMaxs, pm->ps->origin,
+				PM_Trace(&trace, pm->ps->origin, NewMins, NewMaxs, pm->ps->origin,
 										pm->ps->clientNum, pm->tracemask);
 			}
 			else
@@ -2429,7 +2507,7 @@ static qboolean PM_CheckDuck(qboolean PutOnGround, vec3_t NewGravity)
 						pm->ps->origin[i] -= Grav[i] * 0.15f;
 				}
 
-				pm->trace(&trace, pm->ps->origin, NewMins, NewMaxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
+				PM_Trace(&trace, pm->ps->origin, NewMins, NewMaxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
 			}
 		}
 
@@ -2442,7 +2520,7 @@ static qboolean PM_CheckDuck(qboolean PutOnGround, vec3_t NewGravity)
 
 	if (trace.allsolid)
 	{
-		pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
+		PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
 
 		if (trace.allsolid)
 		{
@@ -2461,7 +2539,7 @@ static qboolean PM_CheckDuck(qboolean PutOnGround, vec3_t NewGravity)
 		for (i = 0; i < 3; ++i)
 			Point[i] = pm->ps->origin[i] + Grav[i] * 32;
 
-		pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, Point, pm->ps->clientNum, pm->tracemask);
+		PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, Point, pm->ps->clientNum, pm->tracemask);
 
 		if (!trace.allsolid)
 		{
@@ -2530,7 +2608,7 @@ static qboolean Inv_ApplyNewGround(vec3_t Normal, qboolean AdvanceOnNewGround)
 		for (i = 0; i < 3; ++i)
 			point[i] = pm->ps->origin[i] + Dir[i] * Dist - NewGravity[i] * 0.25f;
 
-		pm->trace(&trace, point, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
+		PM_Trace(&trace, point, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
 		if (!trace.allsolid)
 			VectorCopy(point, pm->ps->origin);
 	}
@@ -2540,7 +2618,7 @@ static qboolean Inv_ApplyNewGround(vec3_t Normal, qboolean AdvanceOnNewGround)
 		//if (Stat)
 		{
 			trace_t trace;
-			pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
+			PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, pm->ps->origin, pm->ps->clientNum, pm->tracemask);
 
 			if (trace.allsolid)
 			{
@@ -2691,7 +2769,7 @@ static qboolean Inv_CheckNewGround(void)
 	VectorSet(maxs, 5, 5, 5);
 
 	VectorMA(pm->ps->origin, Dist, wishvel, point);
-	pm->trace(&trace, pm->ps->origin, mins, maxs, point,
+	PM_Trace(&trace, pm->ps->origin, mins, maxs, point,
 					pm->ps->clientNum, MASK_PLAYERSOLID);
 
 	if (trace.fraction == 1.0f)
@@ -2700,7 +2778,7 @@ static qboolean Inv_CheckNewGround(void)
 	if (trace.contents & CONTENTS_PLAYERCLIP)
 	{
 		VectorMA(trace.endpos, 8, wishvel, point);
-		pm->trace(&trace, pm->ps->origin, mins, maxs, point,
+		PM_Trace(&trace, pm->ps->origin, mins, maxs, point,
 					pm->ps->clientNum, MASK_PLAYERSOLID & ~CONTENTS_PLAYERCLIP);
 	}
 
@@ -2732,7 +2810,7 @@ static void PM_GroundTrace(qboolean Recurs)
 	for (i = 0; i < 3; ++i)
 		point[i] = pm->ps->origin[i] + d * Gravity[i];
 
-	pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
+	PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, point, pm->ps->clientNum, pm->tracemask);
 	pml.groundTrace = trace;
 
 	// do something corrective if the trace starts in a solid...
@@ -2760,7 +2838,7 @@ static void PM_GroundTrace(qboolean Recurs)
 			for (i = 0; i < 3; ++i)
 				point2[i] = pm->ps->origin[i] + 32 * Gravity[i];	//Too: Max_Step_Change
 
-			pm->trace(&trace2, pm->ps->origin, pm->mins, pm->maxs, point2, pm->ps->clientNum, pm->tracemask);
+			PM_Trace(&trace2, pm->ps->origin, pm->mins, pm->maxs, point2, pm->ps->clientNum, pm->tracemask);
 			if (trace2.fraction == 1.0)
 			{
 				VectorCopy(pm->ps->velocity, Dir);
@@ -2775,7 +2853,7 @@ static void PM_GroundTrace(qboolean Recurs)
 					point2[i] = pm->ps->origin[i] - Dir[i] * l;
 				}
 
-				pm->trace(&trace2, point, pm->mins, pm->maxs, point2, pm->ps->clientNum, pm->tracemask);
+				PM_Trace(&trace2, point, pm->mins, pm->maxs, point2, pm->ps->clientNum, pm->tracemask);
 
 				if (trace2.fraction < 1.0)
 				{
@@ -2884,7 +2962,7 @@ static void PM_GroundTrace(qboolean Recurs)
 					point[i] = pm->ps->origin[i] + (0.25f + 8) * Gravity[i];
 				//VectorMA(pm->ps->origin, 0.25f + 5, Gravity, point);
 
-				pm->trace(&trace2, pm->ps->origin, pm->mins, pm->maxs,
+				PM_Trace(&trace2, pm->ps->origin, pm->mins, pm->maxs,
 							point, pm->ps->clientNum, pm->tracemask & ~CONTENTS_PLAYERCLIP);
 
 				if (trace2.fraction == 1.0 || (trace2.surfaceFlags & SURF_SKY))
@@ -4225,6 +4303,10 @@ void PmoveSingle(pmove_t *pmove, InvasionInfo_t *InvInfo)
 	// clear all pmove local vars
 	memset (&pml, 0, sizeof(pml));
 
+	// the world may have changed since the last move
+	pm_numTraceMemo = 0;
+	pm_nextTraceMemo = 0;
+
 	// determine the time
 	pml.msec = pmove->cmd.serverTime - pm->ps->commandTime;
 	if (pml.msec < 1)
@@ -4482,6 +4564,9 @@ void Pmove(pmove_t *pmove, InvasionInfo_t *InvInfo)
 
 	JumpTime = 0;
 
+	pmove->numTraces = 0;
+	pmove->numTraceMemoHits = 0;
+
 	if (pmove->ps->persistant[PERS_TEAM] == InvInfo->MarineTeam)
 	{
 		MarineArmor = pmove->ps->persistant[PERS_CLASS] & e_Class_MarineArmorMask;
@@ -144,6 +144,15 @@ gametype_t;
 typedef enum { GENDER_MALE, GENDER_FEMALE, GENDER_NEUTER }
 gender_t;
 
+// how often a module looks at a cvar of its cvar table
+typedef enum
+{
+	CVU_SECOND,			// about once a second
+	CVU_FRAME,			// every frame
+	CVU_DEMAND			// only when registered, for rom and latched cvars
+}
+cvarUpdate_t;
+
 typedef enum
 {
 	TEAM_FREE,
@@ -259,6 +268,10 @@ typedef struct
 
 	float		xyspeed;
 
+	// trace statistics, accumulated over all the PmoveSingle of a Pmove
+	int			numTraces;			// traces asked by the move code
+	int			numTraceMemoHits;	// of those, answered without tracing
+
 	// for fixed msec Pmove
 	int			pmove_fixed;
 	int			pmove_msec;
@@ -583,9 +596,17 @@ typedef enum
 	EV_RELOAD_WEAPON,
 	EV_GIB_EGG,
 	EV_DECON_INPROGRESS,
+	EV_BULLET_HITS,			// eventParm impacts of otherEntity, see BG_BulletImpactOrigin
 }
 entity_event_t;
 
+// EV_BULLET_HITS packs the bullet impacts of one shooter in one frame,
+// each with an origin and ten bits: the surface dir, or the client hit
+#define	MAX_BULLET_IMPACTS		6
+#define	BULLET_IMPACT_FLESH		0x100
+#define	BULLET_IMPACT_TRACER	0x200
+#define	BULLET_IMPACT_BITS		10
+
 
 typedef enum
 {
@@ -837,6 +858,7 @@ typedef enum
 	ET_INVISIBLE,
 	ET_GRAPPLE,				// grapple hooked on wall
 	ET_TEAM,
+	ET_FLAMESTREAM,			// the puffs of one flamethrower, see FLAME_STREAM_PUFFS
 
 	ET_EVENTS				// any of the EV_* events can be added freestanding
 							// by setting eType to ET_EVENTS + eventNum
@@ -844,11 +866,20 @@ typedef enum
 }
 entityType_t;
 
+// a flame stream entity carries the two newest puffs in pos and apos, with
+// generic1 bits 0 and 1 set when they burn, and counts its puffs in time2
+#define	FLAME_STREAM_PUFFS		24		// puffs alive at once per stream
+#define	FLAME_BURN_MSEC			175		// radius damage interval of a burning puff
+
 
 
 void	BG_EvaluateTrajectory(const trajectory_t *tr, int atTime, vec3_t result);
 void	BG_EvaluateTrajectoryDelta(const trajectory_t *tr, int atTime, vec3_t result);
 
+float	*BG_BulletImpactOrigin(entityState_t *es, int n);
+int		BG_BulletImpact(const entityState_t *es, int n);
+void	BG_SetBulletImpact(entityState_t *es, int n, int bits);
+
 void	BG_AddPredictableEventToPlayerstate(int newEvent, int eventParm, playerState_t *ps);
 
 void	BG_TouchJumpPad(playerState_t *ps, entityState_t *jumppad);
@@ -866,6 +897,31 @@ qboolean	BG_PlayerTouchesItem(playerState_t *ps, entityState_t *item, int atTime
 #define MAX_BOTS			1024
 #define MAX_BOTS_TEXT		8192
 
+#define	INFO_HASH_SIZE		256		// power of two
+
+// an arena or bot, indexed out of its info string by BG_IndexInfos
+typedef struct
+{
+	char		*info;				// all the keys, as read
+	char		name[MAX_QPATH];	// map of an arena, name of a bot
+	int			hashNext;			// next record of the same hash, -1 for none
+}
+infoRecord_t;
+
+typedef struct
+{
+	int				numRecords;
+	infoRecord_t	*records;
+	int				hash[INFO_HASH_SIZE];	// first record of each hash, -1 for none
+}
+infoTable_t;
+
+int				BG_ParseInfos(char *buf, int max, char *infos[], void *(*alloc)(int size));
+int				BG_ArenaGametypes(const char *type);
+void			BG_IndexInfos(infoTable_t *table, infoRecord_t *records, char *infos[], int numInfos,
+							  const char *nameKey);
+infoRecord_t	*BG_FindInfo(const infoTable_t *table, const char *name);
+
 
 // Kamikaze
 
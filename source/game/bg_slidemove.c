@@ -89,7 +89,7 @@ qboolean	PM_SlideMove(qboolean gravity)
 		VectorMA(pm->ps->origin, time_left, pm->ps->velocity, end);
 
 		// see if we can make it there
-		pm->trace (&trace, pm->ps->origin, pm->mins, pm->maxs, end, pm->ps->clientNum, pm->tracemask);
+		PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, end, pm->ps->clientNum, pm->tracemask);
 
 		if (trace.allsolid)
 		{
@@ -276,7 +276,7 @@ void PM_StepSlideMove(qboolean gravity)
 	//down[2] -= STEPSIZE;
 	//VectorSet(up, 0, 0, 1);
 
-	pm->trace (&trace, start_o, pm->mins, pm->maxs, down, pm->ps->clientNum, pm->tracemask);
+	PM_Trace(&trace, start_o, pm->mins, pm->maxs, down, pm->ps->clientNum, pm->tracemask);
 	// never step up when you still have up velocity
 	vel = -DotProduct(Gravity, pm->ps->velocity);
 	//vel = pm->ps->velocity[2];
@@ -296,7 +296,7 @@ void PM_StepSlideMove(qboolean gravity)
 	//up[2] += STEPSIZE;
 
 	// test the player position if they were a stepheight higher
-	pm->trace (&trace, start_o, pm->mins, pm->maxs, up, pm->ps->clientNum, pm->tracemask);
+	PM_Trace(&trace, start_o, pm->mins, pm->maxs, up, pm->ps->clientNum, pm->tracemask);
 	if (trace.allsolid)
 	{
 		if (pm->debugLevel)
@@ -322,7 +322,7 @@ void PM_StepSlideMove(qboolean gravity)
 		down[i] += Gravity[i] * stepSize;
 	//down[2] -= stepSize;
 
-	pm->trace (&trace, pm->ps->origin, pm->mins, pm->maxs, down, pm->ps->clientNum, pm->tracemask);
+	PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, down, pm->ps->clientNum, pm->tracemask);
 	if (!trace.allsolid)
 	{
 		VectorCopy (trace.endpos, pm->ps->origin);
@@ -334,7 +334,7 @@ void PM_StepSlideMove(qboolean gravity)
 
 #if 0
 	// if the down trace can trace back to the original position directly, don't step
-	pm->trace(&trace, pm->ps->origin, pm->mins, pm->maxs, start_o, pm->ps->clientNum, pm->tracemask);
+	PM_Trace(&trace, pm->ps->origin, pm->mins, pm->maxs, start_o, pm->ps->clientNum, pm->tracemask);
 	if (trace.fraction == 1.0)
 	{
 		// use the original move
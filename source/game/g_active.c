@@ -1095,6 +1095,64 @@ void SendPendingPredictableEvents(playerState_t *ps)
 	}
 }
 
+/*
+==============
+G_PmoveTraceStats
+
+With g_pmoveTraces set, sums the pmove traces of marines and aliens
+and prints the averages every g_pmoveTraces seconds
+==============
+*/
+static void G_PmoveTraceStats(gentity_t *ent, pmove_t *pm)
+{
+	pmoveTraceStats_t	*stats;
+	int					i;
+
+	if (g_pmoveTraces.integer <= 0)
+	{
+		return;
+	}
+
+	if (ent->client->ps.persistant[PERS_TEAM] == level.MarineTeam)
+	{
+		stats = &level.pmoveTraceStats[0];
+	}
+	else if (ent->client->ps.persistant[PERS_TEAM] == level.AlienTeam)
+	{
+		stats = &level.pmoveTraceStats[1];
+	}
+	else
+	{
+		return;
+	}
+
+	stats->moves++;
+	stats->traces += pm->numTraces;
+	stats->memoHits += pm->numTraceMemoHits;
+	if (pm->numTraces > stats->worst)
+	{
+		stats->worst = pm->numTraces;
+	}
+
+	if (level.time < level.pmoveTraceStatsTime)
+	{
+		return;
+	}
+	level.pmoveTraceStatsTime = level.time + g_pmoveTraces.integer * 1000;
+
+	for (i = 0; i < 2; i++)
+	{
+		stats = &level.pmoveTraceStats[i];
+		if (stats->moves)
+		{
+			G_Printf("pmove %s: %i moves, %.1f traces/move (worst %i), %i%% from memo\n",
+				i ? "aliens" : "marines", stats->moves, (float)stats->traces / stats->moves,
+				stats->worst, stats->traces ? stats->memoHits * 100 / stats->traces : 0);
+		}
+	}
+	memset(level.pmoveTraceStats, 0, sizeof(level.pmoveTraceStats));
+}
+
 /*
 ==============
 ClientThink
@@ -1349,6 +1407,8 @@ void ClientThink_real(gentity_t *ent)
 		Pmove(&pm, &level.InvasionInfo);
 #endif
 
+	G_PmoveTraceStats(ent, &pm);
+
 	// save results of pmove
 	if (ent->client->ps.eventSequence != oldEventSequence)
 	{
@@ -1672,6 +1732,9 @@ void ClientEndFrame(gentity_t *ent)
 
 	SendPendingPredictableEvents(&ent->client->ps);
 
+	// remember where everyone saw this client, for lag compensation
+	G_StoreClientHistory(ent);
+
 	// set the bit for the reachability area the client is currently in
 //	i = trap_AAS_PointReachabilityAreaIndex(ent->client->ps.origin);
 //	ent->client->areabits[i >> 3] |= 1 << (i & 7);
@@ -227,7 +227,7 @@ static void CelebrateStop(gentity_t *player)
 static void CelebrateStart(gentity_t *player)
 {
 	player->s.torsoAnim = ((player->s.torsoAnim & ANIM_TOGGLEBIT) ^ ANIM_TOGGLEBIT) | TORSO_GESTURE;
-	player->nextthink = level.time + TIMER_GESTURE;
+	G_SetNextThink(player, level.time + TIMER_GESTURE);
 	player->think = CelebrateStop;
 
 	/*
@@ -249,7 +249,7 @@ static void PodiumPlacementThink(gentity_t *podium)
 	vec3_t		origin;
 	vec3_t		f, r, u;
 
-	podium->nextthink = level.time + 100;
+	G_SetNextThink(podium, level.time + 100);
 
 	AngleVectors(level.intermission_angle, vec, NULL, NULL);
 	VectorMA(level.intermission_origin, trap_Cvar_VariableIntegerValue("g_podiumDist"), vec, origin);
@@ -332,7 +332,7 @@ static gentity_t *SpawnPodium(void)
 	trap_LinkEntity (podium);
 
 	podium->think = PodiumPlacementThink;
-	podium->nextthink = level.time + 100;
+	G_SetNextThink(podium, level.time + 100);
 	return podium;
 }
 
@@ -357,7 +357,7 @@ void SpawnModelsOnVictoryPads(void)
 				level.clients[ level.sortedClients[0] ].ps.persistant[PERS_RANK] &~ RANK_TIED_FLAG);
 	if (player)
 	{
-		player->nextthink = level.time + 2000;
+		G_SetNextThink(player, level.time + 2000);
 		player->think = CelebrateStart;
 		podium1 = player;
 	}
@@ -395,7 +395,7 @@ void Svcmd_AbortPodium_f(void)
 
 	if (podium1)
 	{
-		podium1->nextthink = level.time;
+		G_SetNextThink(podium1, level.time);
 		podium1->think = CelebrateStop;
 	}
 }
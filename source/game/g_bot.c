@@ -7,10 +7,14 @@
 
 static int		g_numBots;
 static char		*g_botInfos[MAX_BOTS];
+static infoRecord_t	g_botRecords[MAX_BOTS];
+static infoTable_t	g_botTable;
 
 
 int				g_numArenas;
 static char		*g_arenaInfos[MAX_ARENAS];
+static infoRecord_t	g_arenaRecords[MAX_ARENAS];
+static infoTable_t	g_arenaTable;
 
 
 #define BOT_BEGIN_DELAY_BASE		2000
@@ -34,6 +38,8 @@ extern gentity_t	*podium1;
 extern gentity_t	*podium2;
 extern gentity_t	*podium3;
 
+extern vmCvar_t		bot_thinktime;
+
 float trap_Cvar_VariableValue(const char *var_name)
 {
 	char buf[128];
@@ -44,72 +50,6 @@ float trap_Cvar_VariableValue(const char *var_name)
 
 
 
-/*
-===============
-G_ParseInfos
-===============
-*/
-int G_ParseInfos(char *buf, int max, char *infos[])
-{
-	char	*token;
-	int		count;
-	char	key[MAX_TOKEN_CHARS];
-	char	info[MAX_INFO_STRING];
-
-	count = 0;
-
-	while (1)
-	{
-		token = COM_Parse(&buf);
-		if (!token[0])
-		{
-			break;
-		}
-		if (strcmp(token, "{"))
-		{
-			Com_Printf("Missing { in info file\n");
-			break;
-		}
-
-		if (count == max)
-		{
-			Com_Printf("Max infos exceeded\n");
-			break;
-		}
-
-		info[0] = '\0';
-		while (1)
-		{
-			token = COM_ParseExt(&buf, qtrue);
-			if (!token[0])
-			{
-				Com_Printf("Unexpected end of info file\n");
-				break;
-			}
-			if (!strcmp(token, "}"))
-			{
-				break;
-			}
-			Q_strncpyz(key, token, sizeof(key));
-
-			token = COM_ParseExt(&buf, qfalse);
-			if (!token[0])
-			{
-				strcpy(token, "<NULL>");
-			}
-			Info_SetValueForKey(info, key, token);
-		}
-		//NOTE: extra space for arena number
-		infos[count] = G_Alloc(strlen(info) + strlen("\\num\\") + strlen(va("%d", MAX_ARENAS)) + 1);
-		if (infos[count])
-		{
-			strcpy(infos[count], info);
-			count++;
-		}
-	}
-	return count;
-}
-
 /*
 ===============
 G_LoadArenasFromFile
@@ -138,7 +78,7 @@ static void G_LoadArenasFromFile(char *filename)
 	buf[len] = 0;
 	trap_FS_FCloseFile(f);
 
-	g_numArenas += G_ParseInfos(buf, MAX_ARENAS - g_numArenas, &g_arenaInfos[g_numArenas]);
+	g_numArenas += BG_ParseInfos(buf, MAX_ARENAS - g_numArenas, &g_arenaInfos[g_numArenas], G_Alloc);
 }
 
 /*
@@ -184,27 +124,26 @@ static void G_LoadArenas(void)
 	{
 		Info_SetValueForKey(g_arenaInfos[n], "num", va("%i", n));
 	}
+
+	BG_IndexInfos(&g_arenaTable, g_arenaRecords, g_arenaInfos, g_numArenas, "map");
 }
 
 
 /*
 ===============
-G_GetArenaInfoByNumber
+G_GetArenaInfoByMap
 ===============
 */
 const char *G_GetArenaInfoByMap(const char *map)
 {
-	int			n;
+	infoRecord_t	*rec;
 
-	for (n = 0; n < g_numArenas; n++)
+	rec = BG_FindInfo(&g_arenaTable, map);
+	if (!rec)
 	{
-		if (Q_stricmp(Info_ValueForKey(g_arenaInfos[n], "map"), map) == 0)
-		{
-			return g_arenaInfos[n];
-		}
+		return NULL;
 	}
-
-	return NULL;
+	return rec->info;
 }
 
 
@@ -244,37 +183,45 @@ G_AddRandomBot
 */
 void G_AddRandomBot(int team)
 {
-	int		i, n, num;
-	float	skill;
-	char	*value, netname[36], *teamstr;
-	gclient_t	*cl;
+	static qboolean	botUsed[MAX_BOTS];
+	int				i, n, num;
+	float			skill;
+	char			*value, netname[36], *teamstr;
+	gclient_t		*cl;
+	infoRecord_t	*rec;
 
-	num = 0;
-	for (n = 0; n < g_numBots; n++)
+	// mark the bots already playing once, instead of going through
+	// every client for every bot
+	memset(botUsed, 0, sizeof(botUsed));
+	for (i=0; i< g_maxclients.integer; i++)
 	{
-		value = Info_ValueForKey(g_botInfos[n], "name");
-		//
-		for (i=0; i< g_maxclients.integer; i++)
+		cl = level.clients + i;
+		if (cl->pers.connected != CON_CONNECTED)
 		{
-			cl = level.clients + i;
-			if (cl->pers.connected != CON_CONNECTED)
-			{
-				continue;
-			}
-			if (!(g_entities[cl->ps.clientNum].r.svFlags & SVF_BOT))
-			{
-				continue;
-			}
-			if (team >= 0 && cl->sess.BaseTeam != team)
-			{
-				continue;
-			}
-			if (!Q_stricmp(value, cl->pers.netname))
-			{
-				break;
-			}
+			continue;
+		}
+		if (!(g_entities[cl->ps.clientNum].r.svFlags & SVF_BOT))
+		{
+			continue;
+		}
+		if (team >= 0 && cl->sess.BaseTeam != team)
+		{
+			continue;
+		}
+		rec = BG_FindInfo(&g_botTable, cl->pers.netname);
+		if (rec)
+		{
+			botUsed[rec - g_botRecords] = qtrue;
 		}
-		if (i >= g_maxclients.integer)
+	}
+
+	// bots of the same name are used together, the first of them was marked
+	num = 0;
+	for (n = 0; n < g_numBots; n++)
+	{
+		rec = BG_FindInfo(&g_botTable, g_botRecords[n].name);
+		botUsed[n] = botUsed[rec - g_botRecords];
+		if (!botUsed[n])
 		{
 			num++;
 		}
@@ -282,43 +229,23 @@ void G_AddRandomBot(int team)
 	num = random() * num;
 	for (n = 0; n < g_numBots; n++)
 	{
-		value = Info_ValueForKey(g_botInfos[n], "name");
-		//
-		for (i=0; i< g_maxclients.integer; i++)
+		if (botUsed[n])
 		{
-			cl = level.clients + i;
-			if (cl->pers.connected != CON_CONNECTED)
-			{
-				continue;
-			}
-			if (!(g_entities[cl->ps.clientNum].r.svFlags & SVF_BOT))
-			{
-				continue;
-			}
-			if (team >= 0 && cl->sess.BaseTeam != team)
-			{
-				continue;
-			}
-			if (!Q_stricmp(value, cl->pers.netname))
-			{
-				break;
-			}
+			continue;
 		}
-		if (i >= g_maxclients.integer)
+		num--;
+		if (num <= 0)
 		{
-			num--;
-			if (num <= 0)
-			{
-				skill = trap_Cvar_VariableValue("g_spSkill");
-				if (team == TEAM_RED) teamstr = "red";
-				else if (team == TEAM_BLUE) teamstr = "blue";
-				else teamstr = "";
-				strncpy(netname, value, sizeof(netname)-1);
-				netname[sizeof(netname)-1] = '\0';
-				Q_CleanStr(netname);
-				trap_SendConsoleCommand(EXEC_INSERT, va("addbot %s %f %s %i\n", netname, skill, teamstr, 0));
-				return;
-			}
+			value = Info_ValueForKey(g_botInfos[n], "name");
+			skill = trap_Cvar_VariableValue("g_spSkill");
+			if (team == TEAM_RED) teamstr = "red";
+			else if (team == TEAM_BLUE) teamstr = "blue";
+			else teamstr = "";
+			strncpy(netname, value, sizeof(netname)-1);
+			netname[sizeof(netname)-1] = '\0';
+			Q_CleanStr(netname);
+			trap_SendConsoleCommand(EXEC_INSERT, va("addbot %s %f %s %i\n", netname, skill, teamstr, 0));
+			return;
 		}
 	}
 }
@@ -431,6 +358,296 @@ int G_CountBotPlayers(int team)
 	return num;
 }
 
+/*
+===============================================================================
+
+BOT LOAD
+
+With bot_frameBudget set, the time spent in G_RunFrame and
+BotAIStartFrame is averaged over windows of BOT_LOAD_WINDOW msec. When
+the average stays over the budget the bots think less often, and when
+they already think as seldom as they may, bots are removed and no more
+are added for bot_minplayers. Once the frames stay well under the
+budget, bots are let back in first, then the think time comes back
+down. It takes several windows in a row either way, and the band in
+between changes nothing, so the population doesn't flap.
+
+===============================================================================
+*/
+
+#define BOT_LOAD_WINDOW			2000	// msec of frames averaged together
+#define BOT_LOAD_OVER_WINDOWS	2		// windows over the budget before acting
+#define BOT_LOAD_UNDER_WINDOWS	4		// windows under BOT_LOAD_LOW before giving back
+#define BOT_LOAD_LOW			0.6f	// of the budget
+#define BOT_LOAD_THINK_STEP		25
+#define BOT_LOAD_THINK_MAX		300
+
+typedef struct
+{
+	int		windowTime;			// the window ends then
+	int		frames;
+	int		gameMsec;			// in G_RunFrame this window
+	int		botMsec;			// in BotAIStartFrame this window
+	float	average;			// msec per frame of the last window
+	float	gameAverage;
+	int		overWindows;
+	int		underWindows;
+	int		thinkTime;			// the bots think no more often than this, 0 for no limit
+	int		botCap;				// bot_minplayers adds no bots past this, -1 for no cap
+	int		removed;			// bots taken out since the budget was set
+}
+botLoad_t;
+
+static botLoad_t	botLoad = { 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0 };
+
+/*
+===============
+G_BotLoadTime
+
+Adds msec spent in a frame of the game or of the bots to the window
+===============
+*/
+void G_BotLoadTime(int msec, qboolean game)
+{
+	if (game)
+	{
+		botLoad.gameMsec += msec;
+		botLoad.frames++;
+	}
+	else
+	{
+		botLoad.botMsec += msec;
+	}
+}
+
+/*
+===============
+G_BotLoadThinkTime
+
+The least think time the bots get, 0 when the budget leaves them alone
+===============
+*/
+int G_BotLoadThinkTime(void)
+{
+	return botLoad.thinkTime;
+}
+
+/*
+===============
+G_BotLoadRoom
+
+qfalse when the budget has no room for another bot
+===============
+*/
+static qboolean G_BotLoadRoom(void)
+{
+	return botLoad.botCap < 0 || G_CountBotPlayers(-1) < botLoad.botCap;
+}
+
+/*
+===============
+G_BotLoadShed
+
+Removes a bot, from the team with the most of them
+===============
+*/
+static qboolean G_BotLoadShed(void)
+{
+	if (g_gametype.integer >= GT_TEAM)
+	{
+		if (G_CountBotPlayers(TEAM_RED) >= G_CountBotPlayers(TEAM_BLUE))
+		{
+			if (G_RemoveRandomBot(TEAM_RED))
+			{
+				return qtrue;
+			}
+		}
+		else if (G_RemoveRandomBot(TEAM_BLUE))
+		{
+			return qtrue;
+		}
+	}
+	return G_RemoveRandomBot(-1);
+}
+
+/*
+===============
+G_BotLoadReset
+===============
+*/
+static void G_BotLoadReset(void)
+{
+	botLoad.overWindows = 0;
+	botLoad.underWindows = 0;
+	botLoad.thinkTime = 0;
+	botLoad.botCap = -1;
+	botLoad.removed = 0;
+}
+
+/*
+===============
+G_CheckBotLoad
+
+Closes the window when it is over, and acts on its average
+===============
+*/
+static void G_CheckBotLoad(void)
+{
+	float	budget;
+	int		bots;
+
+	// a map_restart brings the level time back
+	if (level.time < botLoad.windowTime - BOT_LOAD_WINDOW)
+	{
+		botLoad.windowTime = 0;
+	}
+	if (!botLoad.windowTime)
+	{
+		botLoad.windowTime = level.time + BOT_LOAD_WINDOW;
+		botLoad.frames = botLoad.gameMsec = botLoad.botMsec = 0;
+		return;
+	}
+	if (level.time < botLoad.windowTime)
+	{
+		return;
+	}
+
+	if (botLoad.frames)
+	{
+		botLoad.average = (float)(botLoad.gameMsec + botLoad.botMsec) / botLoad.frames;
+		botLoad.gameAverage = (float)botLoad.gameMsec / botLoad.frames;
+	}
+	botLoad.windowTime = level.time + BOT_LOAD_WINDOW;
+	botLoad.frames = botLoad.gameMsec = botLoad.botMsec = 0;
+
+	budget = bot_frameBudget.value;
+	if (budget <= 0 || level.intermissiontime)
+	{
+		if (budget <= 0 && (botLoad.thinkTime || botLoad.botCap >= 0))
+		{
+			G_BotLoadReset();
+		}
+		return;
+	}
+
+	if (botLoad.average > budget)
+	{
+		botLoad.overWindows++;
+		botLoad.underWindows = 0;
+	}
+	else if (botLoad.average < budget * BOT_LOAD_LOW)
+	{
+		botLoad.underWindows++;
+		botLoad.overWindows = 0;
+	}
+	else
+	{
+		botLoad.overWindows = 0;
+		botLoad.underWindows = 0;
+	}
+
+	if (botLoad.overWindows >= BOT_LOAD_OVER_WINDOWS)
+	{
+		botLoad.overWindows = 0;
+
+		// think less often first, then do with fewer bots
+		if (botLoad.thinkTime < BOT_LOAD_THINK_MAX)
+		{
+			if (botLoad.thinkTime < bot_thinktime.integer)
+			{
+				botLoad.thinkTime = bot_thinktime.integer;
+			}
+			botLoad.thinkTime += BOT_LOAD_THINK_STEP;
+			if (botLoad.thinkTime > BOT_LOAD_THINK_MAX)
+			{
+				botLoad.thinkTime = BOT_LOAD_THINK_MAX;
+			}
+			return;
+		}
+
+		bots = G_CountBotPlayers(-1);
+		if (bots > 0 && G_BotLoadShed())
+		{
+			botLoad.botCap = bots - 1;
+			botLoad.removed++;
+			G_Printf("bot load: %.1f msec a frame over the %.1f budget, removed a bot\n", botLoad.average, budget);
+		}
+		return;
+	}
+
+	if (botLoad.underWindows >= BOT_LOAD_UNDER_WINDOWS)
+	{
+		botLoad.underWindows = 0;
+
+		// give back in the other order, bots first
+		if (botLoad.botCap >= 0)
+		{
+			botLoad.botCap++;
+			if (botLoad.removed > 0)
+			{
+				botLoad.removed--;
+			}
+			if (!botLoad.removed)
+			{
+				botLoad.botCap = -1;
+			}
+			return;
+		}
+
+		if (botLoad.thinkTime)
+		{
+			botLoad.thinkTime -= BOT_LOAD_THINK_STEP;
+			if (botLoad.thinkTime <= bot_thinktime.integer)
+			{
+				botLoad.thinkTime = 0;
+			}
+		}
+	}
+}
+
+/*
+===============
+Svcmd_BotLoad_f
+===============
+*/
+void Svcmd_BotLoad_f(void)
+{
+	if (!trap_Cvar_VariableIntegerValue("bot_enable"))
+	{
+		trap_Printf("bots are disabled\n");
+		return;
+	}
+
+	if (bot_frameBudget.value <= 0)
+	{
+		trap_Printf("bot_frameBudget is off\n");
+	}
+	else
+	{
+		trap_Printf(va("budget:     %.1f msec a frame\n", bot_frameBudget.value));
+	}
+	trap_Printf(va("last %i msec: %.1f msec a frame, %.1f game, %.1f bots\n", BOT_LOAD_WINDOW,
+		botLoad.average, botLoad.gameAverage, botLoad.average - botLoad.gameAverage));
+	trap_Printf(va("think time: %i msec%s\n", botLoad.thinkTime > bot_thinktime.integer ? botLoad.thinkTime : bot_thinktime.integer,
+		botLoad.thinkTime > bot_thinktime.integer ? " (stretched)" : ""));
+	if (botLoad.botCap >= 0)
+	{
+		trap_Printf(va("bots:       %i, capped at %i, %i removed\n", G_CountBotPlayers(-1), botLoad.botCap, botLoad.removed));
+	}
+	else
+	{
+		trap_Printf(va("bots:       %i\n", G_CountBotPlayers(-1)));
+	}
+	if (botLoad.overWindows)
+	{
+		trap_Printf(va("%i window(s) over the budget\n", botLoad.overWindows));
+	}
+	else if (botLoad.underWindows)
+	{
+		trap_Printf(va("%i window(s) well under the budget\n", botLoad.underWindows));
+	}
+}
+
 /*
 ===============
 G_CheckMinimumPlayers
@@ -463,7 +680,7 @@ void G_CheckMinimumPlayers(void)
 		humanplayers = G_CountHumanPlayers(TEAM_RED);
 		botplayers = G_CountBotPlayers(	TEAM_RED);
 		//
-		if (humanplayers + botplayers < minplayers)
+		if (humanplayers + botplayers < minplayers && G_BotLoadRoom())
 		{
 			G_AddRandomBot(TEAM_RED);
 		}
@@ -475,7 +692,7 @@ void G_CheckMinimumPlayers(void)
 		humanplayers = G_CountHumanPlayers(TEAM_BLUE);
 		botplayers = G_CountBotPlayers(TEAM_BLUE);
 		//
-		if (humanplayers + botplayers < minplayers)
+		if (humanplayers + botplayers < minplayers && G_BotLoadRoom())
 		{
 			G_AddRandomBot(TEAM_BLUE);
 		}
@@ -493,7 +710,7 @@ void G_CheckMinimumPlayers(void)
 		humanplayers = G_CountHumanPlayers(-1);
 		botplayers = G_CountBotPlayers(-1);
 		//
-		if (humanplayers + botplayers < minplayers)
+		if (humanplayers + botplayers < minplayers && G_BotLoadRoom())
 		{
 			G_AddRandomBot(TEAM_FREE);
 		}
@@ -516,7 +733,7 @@ void G_CheckMinimumPlayers(void)
 		humanplayers = G_CountHumanPlayers(TEAM_FREE);
 		botplayers = G_CountBotPlayers(TEAM_FREE);
 		//
-		if (humanplayers + botplayers < minplayers)
+		if (humanplayers + botplayers < minplayers && G_BotLoadRoom())
 		{
 			G_AddRandomBot(TEAM_FREE);
 		}
@@ -537,6 +754,7 @@ void G_CheckBotSpawn(void)
 	int		n;
 	char	userinfo[MAX_INFO_VALUE];
 
+	G_CheckBotLoad();
 	G_CheckMinimumPlayers();
 
 	for (n = 0; n < BOT_SPAWN_QUEUE_DEPTH; n++)
@@ -1008,7 +1226,7 @@ static void G_LoadBotsFromFile(char *filename)
 	buf[len] = 0;
 	trap_FS_FCloseFile(f);
 
-	g_numBots += G_ParseInfos(buf, MAX_BOTS - g_numBots, &g_botInfos[g_numBots]);
+	g_numBots += BG_ParseInfos(buf, MAX_BOTS - g_numBots, &g_botInfos[g_numBots], G_Alloc);
 }
 
 /*
@@ -1054,6 +1272,8 @@ static void G_LoadBots(void)
 		G_LoadBotsFromFile(filename);
 	}
 	trap_Printf(va("%i bots parsed\n", g_numBots));
+
+	BG_IndexInfos(&g_botTable, g_botRecords, g_botInfos, g_numBots, "name");
 }
 
 
@@ -1081,19 +1301,14 @@ G_GetBotInfoByName
 */
 char *G_GetBotInfoByName(const char *name)
 {
-	int		n;
-	char	*value;
+	infoRecord_t	*rec;
 
-	for (n = 0; n < g_numBots; n++)
+	rec = BG_FindInfo(&g_botTable, name);
+	if (!rec)
 	{
-		value = Info_ValueForKey(g_botInfos[n], "name");
-		if (!Q_stricmp(value, name))
-		{
-			return g_botInfos[n];
-		}
+		return NULL;
 	}
-
-	return NULL;
+	return rec->info;
 }
 
 /*
@@ -58,37 +58,241 @@ void SP_info_player_intermission(gentity_t *ent)
 =======================================================================
 */
 
+/*
+================
+Spawn point index
+
+Spawn points don't change during a level. They are sorted by kind
+once, right after the entities are spawned, instead of being found
+with G_Find on every respawn. For each pair of spots of a kind, it is
+also recorded whether one player box covers both. A wave of players
+spawning in the same frame can then be handed distinct spots in one
+pass.
+================
+*/
+#define	MAX_SPAWN_POINTS	128
+
+static gentity_t	*spawnPoints[SPAWN_NUM_KINDS][MAX_SPAWN_POINTS];
+static int			numSpawnPoints[SPAWN_NUM_KINDS];
+static byte			spawnOverlap[SPAWN_NUM_KINDS][MAX_SPAWN_POINTS][MAX_SPAWN_POINTS / 8];
+static gentity_t	*initialSpawnPoint;
+
+static int			spawnWaveTime[SPAWN_NUM_KINDS];
+static int			spawnWave[SPAWN_NUM_KINDS][MAX_SPAWN_POINTS];
+static int			spawnWaveNum[SPAWN_NUM_KINDS];
+static int			spawnWaveNext[SPAWN_NUM_KINDS];
+
+static const char	*spawnClassnames[SPAWN_NUM_KINDS] =
+{
+	"info_player_deathmatch",
+	"team_CTF_redplayer",
+	"team_CTF_blueplayer",
+	"team_CTF_redspawn",
+	"team_CTF_bluespawn"
+};
+
+/*
+================
+G_SpotsOverlap
+
+Would players on these two spots telefrag each other
+================
+*/
+static qboolean G_SpotsOverlap(const vec3_t a, const vec3_t b)
+{
+	int		i;
+
+	for (i = 0; i < 3; i++)
+	{
+		if (a[i] + playerMins[i] > b[i] + playerMaxs[i] || a[i] + playerMaxs[i] < b[i] + playerMins[i])
+		{
+			return qfalse;
+		}
+	}
+	return qtrue;
+}
+
+/*
+================
+G_InitSpawnPoints
+================
+*/
+void G_InitSpawnPoints(void)
+{
+	gentity_t	*spot;
+	int			kind, i, j, n;
+
+	initialSpawnPoint = NULL;
+	memset(spawnOverlap, 0, sizeof(spawnOverlap));
+	memset(spawnWaveTime, 0, sizeof(spawnWaveTime));
+	memset(spawnWaveNum, 0, sizeof(spawnWaveNum));
+
+	for (kind = 0; kind < SPAWN_NUM_KINDS; kind++)
+	{
+		n = 0;
+		spot = NULL;
+		while ((spot = G_Find(spot, FOFS(classname), spawnClassnames[kind])) != NULL)
+		{
+			if (n == MAX_SPAWN_POINTS)
+			{
+				G_Printf("MAX_SPAWN_POINTS hit for %s\n", spawnClassnames[kind]);
+				break;
+			}
+			if (kind == SPAWN_DEATHMATCH && !initialSpawnPoint && (spot->spawnflags & 1))
+			{
+				initialSpawnPoint = spot;
+			}
+			spawnPoints[kind][n++] = spot;
+		}
+		numSpawnPoints[kind] = n;
+
+		for (i = 0; i < n; i++)
+		{
+			for (j = i + 1; j < n; j++)
+			{
+				if (G_SpotsOverlap(spawnPoints[kind][i]->s.origin, spawnPoints[kind][j]->s.origin))
+				{
+					spawnOverlap[kind][i][j >> 3] |= 1 << (j & 7);
+					spawnOverlap[kind][j][i >> 3] |= 1 << (i & 7);
+				}
+			}
+		}
+	}
+}
+
 /*
 ================
 SpotWouldTelefrag
 
+Checks the boxes of the clients, the only entities that matter here,
+instead of asking for everything in the box
 ================
 */
 qboolean SpotWouldTelefrag(gentity_t *spot)
 {
-	int			i, num;
-	int			touch[MAX_GENTITIES];
+	int			i;
 	gentity_t	*hit;
 	vec3_t		mins, maxs;
 
 	VectorAdd(spot->s.origin, playerMins, mins);
 	VectorAdd(spot->s.origin, playerMaxs, maxs);
-	num = trap_EntitiesInBox(mins, maxs, touch, MAX_GENTITIES);
 
-	for (i=0; i<num; i++)
+	for (i = 0, hit = g_entities; i < level.maxclients; i++, hit++)
 	{
-		hit = &g_entities[touch[i]];
 		//if (hit->client && hit->client->ps.stats[STAT_HEALTH] > 0)
-		if (hit->client)
+		if (!hit->inuse || !hit->client || !hit->r.linked)
 		{
-			return qtrue;
+			continue;
 		}
-
+		if (hit->r.absmin[0] > maxs[0] || hit->r.absmin[1] > maxs[1] || hit->r.absmin[2] > maxs[2]
+			|| hit->r.absmax[0] < mins[0] || hit->r.absmax[1] < mins[1] || hit->r.absmax[2] < mins[2])
+		{
+			continue;
+		}
+		return qtrue;
 	}
 
 	return qfalse;
 }
 
+/*
+================
+G_DrawSpawnWave
+
+Shuffles the free spots of a kind, keeping only spots that don't
+overlap one drawn before them
+================
+*/
+static void G_DrawSpawnWave(spawnKind_t kind)
+{
+	int		avail[MAX_SPAWN_POINTS];
+	byte	taken[MAX_SPAWN_POINTS / 8];
+	int		i, j, n, num, t;
+
+	num = 0;
+	for (i = 0; i < numSpawnPoints[kind]; i++)
+	{
+		if (!SpotWouldTelefrag(spawnPoints[kind][i]))
+		{
+			avail[num++] = i;
+		}
+	}
+
+	for (i = num - 1; i > 0; i--)
+	{
+		j = rand() % (i + 1);
+		t = avail[i];
+		avail[i] = avail[j];
+		avail[j] = t;
+	}
+
+	memset(taken, 0, sizeof(taken));
+	n = 0;
+	for (i = 0; i < num; i++)
+	{
+		if (taken[avail[i] >> 3] & (1 << (avail[i] & 7)))
+		{
+			continue;
+		}
+		spawnWave[kind][n++] = avail[i];
+		for (j = 0; j < MAX_SPAWN_POINTS / 8; j++)
+		{
+			taken[j] |= spawnOverlap[kind][avail[i]][j];
+		}
+	}
+
+	spawnWaveTime[kind] = level.time;
+	spawnWaveNum[kind] = n;
+	spawnWaveNext[kind] = 0;
+}
+
+/*
+================
+G_SelectWaveSpawnPoint
+
+A random spot of a kind that doesn't telefrag. Everyone spawning in
+the same frame, like a whole team after a round restart, draws from
+the same shuffle and gets a spot of their own. Returns the first spot
+if they are all taken, and NULL if the map has none.
+================
+*/
+gentity_t *G_SelectWaveSpawnPoint(spawnKind_t kind)
+{
+	gentity_t	*spot;
+	qboolean	redrawn = qfalse;
+
+	if (!numSpawnPoints[kind])
+	{
+		return NULL;
+	}
+
+	for (;;)
+	{
+		if (spawnWaveTime[kind] != level.time || spawnWaveNext[kind] >= spawnWaveNum[kind])
+		{
+			if (redrawn)
+			{
+				break;
+			}
+			G_DrawSpawnWave(kind);
+			redrawn = qtrue;
+		}
+
+		while (spawnWaveNext[kind] < spawnWaveNum[kind])
+		{
+			spot = spawnPoints[kind][spawnWave[kind][spawnWaveNext[kind]++]];
+			// somebody may have walked in since the wave was drawn
+			if (!SpotWouldTelefrag(spot))
+			{
+				return spot;
+			}
+		}
+	}
+
+	// no spots that won't telefrag
+	return spawnPoints[kind][0];
+}
+
 /*
 ================
 SelectNearestDeathmatchSpawnPoint
@@ -96,20 +300,20 @@ SelectNearestDeathmatchSpawnPoint
 Find the spot that we DON'T want to use
 ================
 */
-#define	MAX_SPAWN_POINTS	128
 gentity_t *SelectNearestDeathmatchSpawnPoint(vec3_t from)
 {
 	gentity_t	*spot;
 	vec3_t		delta;
 	float		dist, nearestDist;
 	gentity_t	*nearestSpot;
+	int			i;
 
 	nearestDist = 999999;
 	nearestSpot = NULL;
-	spot = NULL;
 
-	while ((spot = G_Find (spot, FOFS(classname), "info_player_deathmatch")) != NULL)
+	for (i = 0; i < numSpawnPoints[SPAWN_DEATHMATCH]; i++)
 	{
+		spot = spawnPoints[SPAWN_DEATHMATCH][i];
 
 		VectorSubtract(spot->s.origin, from, delta);
 		dist = VectorLength(delta);
@@ -131,33 +335,22 @@ SelectRandomDeathmatchSpawnPoint
 go to a random point that doesn't telefrag
 ================
 */
-#define	MAX_SPAWN_POINTS	128
 gentity_t *SelectRandomDeathmatchSpawnPoint(void)
 {
-	gentity_t	*spot;
-	int			count;
-	int			selection;
-	gentity_t	*spots[MAX_SPAWN_POINTS];
-
-	count = 0;
-	spot = NULL;
+	return G_SelectWaveSpawnPoint(SPAWN_DEATHMATCH);
+}
 
-	while ((spot = G_Find (spot, FOFS(classname), "info_player_deathmatch")) != NULL)
-	{
-		if (SpotWouldTelefrag(spot))
-		{
-			continue;
-		}
-		spots[ count ] = spot;
-		count++;
-	}
+typedef struct
+{
+	float		dist;
+	gentity_t	*spot;
+} spawnDist_t;
 
-	if (!count) {	// no spots that won't telefrag
-		return G_Find(NULL, FOFS(classname), "info_player_deathmatch");
-	}
+static int QDECL SortSpawnDist(const void *a, const void *b)
+{
+	float	d = ((const spawnDist_t *)b)->dist - ((const spawnDist_t *)a)->dist;
 
-	selection = rand() % count;
-	return spots[ selection ];
+	return (d > 0) - (d < 0);
 }
 
 /*
@@ -171,67 +364,47 @@ gentity_t *SelectRandomFurthestSpawnPoint (vec3_t avoidPoint, vec3_t origin, vec
 {
 	gentity_t	*spot;
 	vec3_t		delta;
-	float		dist;
-	float		list_dist[64];
-	gentity_t	*list_spot[64];
-	int			numSpots, rnd, i, j;
+	spawnDist_t	list[MAX_SPAWN_POINTS];
+	int			numSpots, rnd, i;
 
 	numSpots = 0;
-	spot = NULL;
 
-	while ((spot = G_Find (spot, FOFS(classname), "info_player_deathmatch")) != NULL)
+	for (i = 0; i < numSpawnPoints[SPAWN_DEATHMATCH]; i++)
 	{
+		spot = spawnPoints[SPAWN_DEATHMATCH][i];
 		if (SpotWouldTelefrag(spot))
 		{
 			continue;
 		}
 		VectorSubtract(spot->s.origin, avoidPoint, delta);
-		dist = VectorLength(delta);
-		for (i = 0; i < numSpots; i++)
-		{
-			if (dist > list_dist[i])
-			{
-				if (numSpots >= 64)
-					numSpots = 64-1;
-				for (j = numSpots; j > i; j--)
-				{
-					list_dist[j] = list_dist[j-1];
-					list_spot[j] = list_spot[j-1];
-				}
-				list_dist[i] = dist;
-				list_spot[i] = spot;
-				numSpots++;
-				if (numSpots > 64)
-					numSpots = 64;
-				break;
-			}
-		}
-		if (i >= numSpots && numSpots < 64)
-		{
-			list_dist[numSpots] = dist;
-			list_spot[numSpots] = spot;
-			numSpots++;
-		}
+		list[numSpots].dist = VectorLength(delta);
+		list[numSpots].spot = spot;
+		numSpots++;
 	}
 	if (!numSpots)
 	{
-		spot = G_Find(NULL, FOFS(classname), "info_player_deathmatch");
-		if (!spot)
+		if (!numSpawnPoints[SPAWN_DEATHMATCH])
 			G_Error("Couldn't find a spawn point");
+		spot = spawnPoints[SPAWN_DEATHMATCH][0];
 		VectorCopy (spot->s.origin, origin);
 		origin[2] += 9;
 		VectorCopy (spot->s.angles, angles);
 		return spot;
 	}
 
+	// the 64 furthest spots, furthest first
+	qsort(list, numSpots, sizeof(list[0]), SortSpawnDist);
+	if (numSpots > 64)
+		numSpots = 64;
+
 	// select a random spot from the spawn points furthest away
 	rnd = random() * (numSpots / 2);
 
-	VectorCopy (list_spot[rnd]->s.origin, origin);
+	VectorCopy (list[rnd].spot->s.origin, origin);
 	origin[2] += 9;
-	VectorCopy (list_spot[rnd]->s.angles, angles);
+	VectorCopy (list[rnd].spot->s.angles, angles);
 
-	return list_spot[rnd];
+	return list[rnd].spot;
 }
 
 /*
@@ -289,14 +462,7 @@ gentity_t *SelectInitialSpawnPoint(vec3_t origin, vec3_t angles)
 {
 	gentity_t	*spot;
 
-	spot = NULL;
-	while ((spot = G_Find (spot, FOFS(classname), "info_player_deathmatch")) != NULL)
-	{
-		if (spot->spawnflags & 1)
-		{
-			break;
-		}
-	}
+	spot = initialSpawnPoint;
 
 	if (!spot || SpotWouldTelefrag(spot))
 	{
@@ -371,7 +537,7 @@ void BodySink(gentity_t *ent)
 		ent->physicsObject = qfalse;
 		return;
 	}
-	ent->nextthink = level.time + 50;
+	G_SetNextThink(ent, level.time + 50);
 	ent->s.pos.trBase[2] -= 0.5f;
 }
 
@@ -387,12 +553,12 @@ void BodyRadiate(gentity_t *ent)
 	if (level.time - ent->timestamp > 4500)
 	{
 		ent->timestamp = level.time;
-		ent->nextthink = level.time + 500;
+		G_SetNextThink(ent, level.time + 500);
 		ent->think = BodySink;
 	}
 	else
 	{
-		ent->nextthink = level.time + 500;
+		G_SetNextThink(ent, level.time + 500);
 		ent->think = BodyRadiate;
 	}
 
@@ -527,7 +693,7 @@ void CopyToBodyQue(gentity_t *ent)
 	body->r.ownerNum = ent->s.number;
 	body->client = client;
 
-	body->nextthink = level.time + 5000;
+	G_SetNextThink(body, level.time + 5000);
 	body->think = BodySink;
 
 	body->die = body_die;
@@ -547,13 +713,13 @@ void CopyToBodyQue(gentity_t *ent)
 	{
 		if (client->sess.sessionTeam == level.MarineTeam)
 		{
-			body->nextthink = 0;
+			G_SetNextThink(body, 0);
 		}
 	}
 	else
 	{
 		body->timestamp += 10000;
-		body->nextthink += 10000;
+		G_SetNextThink(body, body->nextthink + 10000);
 	}
 
 	if (client->sess.sessionTeam == level.AlienTeam)
@@ -561,19 +727,22 @@ void CopyToBodyQue(gentity_t *ent)
 		if (client->pers.AlienRace == e_Selection_Rad)
 		{
 			body->parent = ent;
-			body->nextthink = level.time + 500;
+			G_SetNextThink(body, level.time + 500);
 			body->think = BodyRadiate;
 		}
 		else
 		{
 			body->timestamp += 10000;
-			body->nextthink += 10000;
+			G_SetNextThink(body, body->nextthink + 10000);
 		}
 	}
 
 	VectorCopy(body->s.pos.trBase, body->r.currentOrigin);
 	trap_LinkEntity(body);
 	body->s.solid = 1;
+
+	// a reused body may have been resting, it has to fall and be pushed
+	G_WakeEntity(body);
 }
 
 //======================================================================
@@ -202,7 +202,7 @@ void TossClientCubes(gentity_t *self)
 
 	drop = LaunchItem(item, origin, velocity);
 
-	drop->nextthink = level.time + g_cubeTimeout.integer * 1000;
+	G_SetNextThink(drop, level.time + g_cubeTimeout.integer * 1000);
 	drop->think = G_FreeEntity;
 	drop->spawnflags = self->client->sess.sessionTeam;
 }
@@ -394,7 +394,7 @@ void Kamikaze_DeathTimer(gentity_t *self)
 	VectorCopy(self->s.pos.trBase, ent->s.pos.trBase);
 	ent->r.svFlags |= SVF_NOCLIENT;
 	ent->think = Kamikaze_DeathActivate;
-	ent->nextthink = level.time + 5 * 1000;
+	G_SetNextThink(ent, level.time + 5 * 1000);
 
 	ent->activator = self;
 }
@@ -548,7 +548,7 @@ void player_die(gentity_t *self, gentity_t *inflictor, gentity_t *attacker, int
 	{
 		SelfCl->ps.eFlags &= ~EF_TICKING;
 		self->activator->think = G_FreeEntity;
-		self->activator->nextthink = level.time;
+		G_SetNextThink(self->activator, level.time);
 	}
 #endif
 	SelfCl->ps.pm_type = PM_DEAD;
@@ -699,22 +699,38 @@ void InvasionWin(team_t Team, qboolean FlagLost)
 }
 
 
+/*
+=================
+InvasionRoundTimeChanged
+
+Inv_RoundTime changed, move the end of the current round
+=================
+*/
+void InvasionRoundTimeChanged(void)
+{
+	int EndTime;
+
+	if (g_InvRoundTime.integer < 60)
+		g_InvRoundTime.integer = 60;
+
+	if ((g_gametype.integer != GT_INVASION && g_gametype.integer != GT_DESTROY)
+		|| level.Period != e_Period_Playing)
+		return;
+
+	EndTime = level.RoundStartTime + g_InvRoundTime.integer * 1000;
+	trap_SetConfigstring(CS_GAMETIMELEFT, va("%i", EndTime));
+}
+
+
 void InvasionMain(void)
 {
 	switch (level.Period)
 	{
 		case e_Period_Playing:
 		{
-			if (g_InvRoundTime.modificationCount != level.RoundTimeModifCount || g_InvRoundTime.integer < 60)
+			if (g_InvRoundTime.integer < 60)
 			{
-				int EndTime;
-
-				if (g_InvRoundTime.integer < 60)
-					g_InvRoundTime.integer = 60;
-
-				level.RoundTimeModifCount = g_InvRoundTime.modificationCount;
-				EndTime = level.RoundStartTime + g_InvRoundTime.integer * 1000;
-				trap_SetConfigstring(CS_GAMETIMELEFT, va("%i", EndTime));
+				InvasionRoundTimeChanged();
 			}
 
 			if (level.time - level.RoundStartTime > g_InvRoundTime.integer * 1000)
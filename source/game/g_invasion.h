@@ -14,6 +14,7 @@ extern vmCvar_t	g_InvAutoMode;
 
 void InvasionStart(int Restart);
 void InvasionMain(void);
+void InvasionRoundTimeChanged(void);
 void InvasionFinishRound(qboolean Restart);
 void InvasionSetMarineTeam(team_t Team);
 void InvasionSendInfo(void);
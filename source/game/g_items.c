@@ -389,6 +389,7 @@ void RespawnItem(gentity_t *ent)
 	ent->s.eFlags &= ~EF_NODRAW;
 	ent->r.svFlags &= ~SVF_NOCLIENT;
 	trap_LinkEntity (ent);
+	G_WakeEntity(ent);
 
 	if (ent->item->giType == IT_POWERUP)
 	{
@@ -429,7 +430,7 @@ void RespawnItem(gentity_t *ent)
 	// play the normal respawn sound only to nearby clients
 	G_AddEvent(ent, EV_ITEM_RESPAWN, 0);
 
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 
@@ -543,6 +544,7 @@ void Touch_Item (gentity_t *ent, gentity_t *other, trace_t *trace)
 		ent->s.eFlags |= EF_NODRAW;
 		ent->r.contents = 0;
 		ent->unlinkAfterEvent = qtrue;
+		G_WakeEntity(ent);
 		return;
 	}
 
@@ -566,6 +568,7 @@ void Touch_Item (gentity_t *ent, gentity_t *other, trace_t *trace)
 	if (ent->flags & FL_DROPPED_ITEM)
 	{
 		ent->freeAfterEvent = qtrue;
+		G_WakeEntity(ent);
 	}
 
 	// picked up items still stay around, they just don't
@@ -581,12 +584,12 @@ void Touch_Item (gentity_t *ent, gentity_t *other, trace_t *trace)
 	// events such as ctf flags
 	if (respawn <= 0)
 	{
-		ent->nextthink = 0;
+		G_SetNextThink(ent, 0);
 		ent->think = 0;
 	}
 	else
 	{
-		ent->nextthink = level.time + respawn * 1000;
+		G_SetNextThink(ent, level.time + respawn * 1000);
 		ent->think = RespawnItem;
 	}
 	trap_LinkEntity(ent);
@@ -610,9 +613,9 @@ void Touch_Item_On(gentity_t *ed)
 	ed->touch = Touch_Item;
 	ed->think = Touch_Item_On;
 	if (g_gametype.integer == GT_CTF)
-		ed->nextthink = level.time + 30 * 1000;
+		G_SetNextThink(ed, level.time + 30 * 1000);
 	else
-		ed->nextthink = level.time + 60 * 60 * 1000;		// Neither free this entity
+		G_SetNextThink(ed, level.time + 60 * 60 * 1000);		// Neither free this entity
 	ed->s.eFlags &= ~EF_NODRAW;
 	ed->r.svFlags &= ~SVF_NOCLIENT;
 }
@@ -660,12 +663,12 @@ gentity_t *LaunchItem(gitem_t *item, vec3_t origin, vec3_t velocity, qboolean Do
 #endif
 		if (g_gametype.integer == GT_INVASION)
 		{
-			dropped->nextthink = 0;							//Too: don't bring back dropped flag
+			G_SetNextThink(dropped, 0);							//Too: don't bring back dropped flag
 		}
 		else
 		{
 			dropped->think = Team_DroppedFlagThink;
-			dropped->nextthink = level.time + 30000;
+			G_SetNextThink(dropped, level.time + 30000);
 		}
 
 		Team_CheckDroppedItem(dropped);
@@ -676,12 +679,12 @@ gentity_t *LaunchItem(gitem_t *item, vec3_t origin, vec3_t velocity, qboolean Do
 		dropped->r.svFlags |= SVF_NOCLIENT;
 		dropped->touch = Touch_Item_Dummy;
 		dropped->think = Touch_Item_On;
-		dropped->nextthink = level.time + 700;
+		G_SetNextThink(dropped, level.time + 700);
 	}
 	else
 	{ // auto-remove after 30 seconds
 		dropped->think = G_FreeEntity;
-		dropped->nextthink = level.time + 30000;
+		G_SetNextThink(dropped, level.time + 30000);
 	}
 
 	dropped->flags = FL_DROPPED_ITEM;
@@ -814,7 +817,7 @@ void FinishSpawningItem(gentity_t *ent)
 		respawn = 45 + crandom() * 15;
 		ent->s.eFlags |= EF_NODRAW;
 		ent->r.contents = 0;
-		ent->nextthink = level.time + respawn * 1000;
+		G_SetNextThink(ent, level.time + respawn * 1000);
 		ent->think = RespawnItem;
 		return;
 	}
@@ -1099,7 +1102,7 @@ void G_SpawnItem(gentity_t *ent, gitem_t *item)
 	ent->item = item;
 	// some movers spawn on the second frame, so delay item
 	// spawns until the third frame so they can ride trains
-	ent->nextthink = level.time + FRAMETIME * 2;
+	G_SetNextThink(ent, level.time + FRAMETIME * 2);
 	ent->think = FinishSpawningItem;
 
 	ent->physicsBounce = 0.50;		// items are bouncy
@@ -1201,14 +1204,17 @@ void G_RunItem(gentity_t *ent)
 	trap_Trace(&tr, ent->r.currentOrigin, ent->r.mins, ent->r.maxs, origin,
 		ent->r.ownerNum, mask);
 
-	VectorCopy(tr.endpos, ent->r.currentOrigin);
-
 	if (tr.startsolid)
 	{
 		tr.fraction = 0;
 	}
 
-	trap_LinkEntity(ent);	// FIXME: avoid this for stationary?
+	// only relink if the trace actually moved it
+	if (!ent->r.linked || !VectorCompare(tr.endpos, ent->r.currentOrigin))
+	{
+		VectorCopy(tr.endpos, ent->r.currentOrigin);
+		trap_LinkEntity(ent);
+	}
 
 	// check think function
 	G_RunThink(ent);
@@ -130,7 +130,9 @@ struct gentity_s
 	float		speed;
 	vec3_t		movedir;
 
-	int			nextthink;
+	int			nextthink;		// set with G_SetNextThink
+	gentity_t	*thinkNext;		// think wheel slot list
+	gentity_t	**thinkPrev;	// NULL when not in the wheel
 	void		(*think)(gentity_t *self);
 	void		(*reached)(gentity_t *self);	// movers call this when hitting endpoint
 	void		(*blocked)(gentity_t *self, gentity_t *other);
@@ -153,6 +155,11 @@ struct gentity_s
 	int			methodOfDeath;
 	int			splashMethodOfDeath;
 
+	// the world path of a linear missile, see G_MissilePathClear
+	int			missileClearTime;		// clear up to this time
+	int			missileClearTrTime;		// s.pos.trTime it was traced for
+	qboolean	missileClearOpen;		// nothing hit, trace again later
+
 	int			count;
 
 	gentity_t	*chain;
@@ -272,6 +279,7 @@ typedef struct
 	int			voteCount;			// to prevent people from constantly calling votes
 	int			teamVoteCount;		// to prevent people from constantly calling votes
 	qboolean	teamInfo;			// send team overlay updates?
+	int			teamInfoHash;		// of the last team overlay update sent
 
 	//Too: Invasion Stuff
 	int WaitForSelection;		// Server wait the client selection (weapon, race, ...)
@@ -283,6 +291,19 @@ typedef struct
 clientPersistant_t;
 
 
+// where a client was at the end of a server frame, for lag compensation
+#define	CLIENT_HISTORY_SIZE		32			// power of two
+
+typedef struct
+{
+	int			time;
+	vec3_t		origin;
+	short		mins[3];
+	short		maxs[3];
+	int			teleportBit;		// EF_TELEPORT_BIT at that time
+}
+clientHistory_t;
+
 // this structure is cleared on each ClientSpawn(),
 // except for 'client->pers' and 'client->sess'
 struct gclient_s
@@ -347,6 +368,10 @@ struct gclient_s
 	int			RadiationTime;		// Used for Rad radiation
 	qboolean		TrackGauntletHit;	// Attacking with it, so can hit something
 
+	clientHistory_t	history[CLIENT_HISTORY_SIZE];	// see G_StoreClientHistory
+	int			historyHead;		// newest sample
+	int			historyCount;
+
 #ifdef MISSIONPACK
 	gentity_t	*persistantPowerup;
 	int			portalID;
@@ -358,6 +383,35 @@ struct gclient_s
 };
 
 
+// pmove trace counts of one side, see g_pmoveTraces
+typedef struct
+{
+	int			moves;
+	int			traces;
+	int			memoHits;
+	int			worst;					// most traces in a single Pmove
+}
+pmoveTraceStats_t;
+
+// think counts, see g_thinkStats
+typedef struct
+{
+	int			frames;
+	int			thinks;
+	int			visits;					// entities G_RunFrame looked at
+	int			worst;					// most thinks in a single frame
+}
+thinkStats_t;
+
+// the nextthink timer wheel: 256 slots of one msec, then three levels
+// of 64 slots each covering 64 times the span of the level below
+#define	THINK_WHEEL_BITS0		8
+#define	THINK_WHEEL_BITS		6
+#define	THINK_WHEEL_SIZE0		(1 << THINK_WHEEL_BITS0)
+#define	THINK_WHEEL_SIZE		(1 << THINK_WHEEL_BITS)
+#define	THINK_WHEEL_LEVELS		3
+#define	THINK_WHEEL_SLOTS		(THINK_WHEEL_SIZE0 + THINK_WHEEL_LEVELS * THINK_WHEEL_SIZE)
+
 //
 // this structure is cleared as each map is entered
 //
@@ -450,7 +504,6 @@ typedef struct
 	qboolean InternalRestart;		// used to make difference between "round & warmup map_restart" and "user map_restart"
 	int GameStartTime;				// for timelimit handling
 	int RoundStartTime;				// To finish the Round on a time basis
-	int RoundTimeModifCount;
 	int InvWarmupModifCount;		// for detecting if g_warmup is changed
 	team_t MarineTeam;				// num of the current Marine team
 	team_t AlienTeam;					// num of the current Alien team
@@ -459,6 +512,17 @@ typedef struct
 	InvasionInfo_t InvasionInfo;	// Used for prediction stuff (not very clean to have redundance here,
 											// but it seems to be easier to maintain ! :) and it loose something 12 bytes, not terrible)
 
+	pmoveTraceStats_t pmoveTraceStats[2];	// marines, aliens
+	int			pmoveTraceStatsTime;		// next time they are printed
+
+	unsigned	activeEntities[MAX_GENTITIES/32];	// entities G_RunFrame has to visit, see G_WakeEntity
+	gentity_t	*thinkWheel[THINK_WHEEL_SLOTS];	// scheduled thinks, see G_SetNextThink
+	int			thinkWheelTime;				// first msec not yet run out of the wheel
+	int			frameThinks;				// thinks run this frame
+	int			frameVisits;				// entities visited this frame
+	thinkStats_t	thinkStats;
+	int			thinkStatsTime;				// next time they are printed
+
 #ifdef MISSIONPACK
 	int			portalSequence;
 #endif
@@ -515,6 +579,7 @@ void SaveRegisteredItems(void);
 //
 // g_utils.c
 //
+void	G_InitConfigstringIndexes(void);
 int G_ModelIndex(char *name);
 int		G_SoundIndex(char *name);
 void	G_TeamCommand(team_t team, char *cmd);
@@ -530,6 +595,10 @@ gentity_t *G_TempEntity(vec3_t origin, int event);
 void	G_Sound(gentity_t *ent, int channel, int soundIndex);
 void	G_FreeEntity(gentity_t *e);
 qboolean	G_EntitiesFree(void);
+void	G_WakeEntity(gentity_t *ent);
+void	G_SleepEntity(gentity_t *ent);
+void	G_SetNextThink(gentity_t *ent, int time);
+void	G_RunThinkWheel(void);
 
 void	G_TouchTriggers (gentity_t *ent);
 void	G_TouchSolids (gentity_t *ent);
@@ -576,11 +645,12 @@ void GibEntity(gentity_t *self, int killer);
 //
 // g_missile.c
 //
-void G_RunMissile(gentity_t *ent);
+void G_RunMissiles(gentity_t **missiles, int numMissiles);
 
 gentity_t *fire_blaster(gentity_t *self, vec3_t start, vec3_t aimdir);
 gentity_t *fire_plasma(gentity_t *self, vec3_t start, vec3_t aimdir, int Parm);
 gentity_t *fire_Flame(gentity_t *self, vec3_t start, vec3_t aimdir, int Parm);
+void fire_FlameStream(gentity_t *self, vec3_t start, vec3_t aimdir, int Parm, float damageScale);
 gentity_t *fire_grenade(gentity_t *self, vec3_t start, vec3_t aimdir);
 gentity_t *fire_rocket(gentity_t *self, vec3_t start, vec3_t dir);
 gentity_t *fire_bfg(gentity_t *self, vec3_t start, vec3_t dir, int Parm);
@@ -596,6 +666,7 @@ gentity_t *fire_prox(gentity_t *self, vec3_t start, vec3_t aimdir);
 // g_mover.c
 //
 void G_RunMover(gentity_t *ent);
+void G_PushCandidateSettled(gentity_t *ent);
 void Touch_DoorTrigger(gentity_t *ent, gentity_t *other, trace_t *trace);
 
 //
@@ -621,9 +692,23 @@ qboolean LogAccuracyHit(gentity_t *target, gentity_t *attacker);
 void CalcMuzzlePoint (gentity_t *ent, vec3_t forward, vec3_t right, vec3_t up, vec3_t muzzlePoint);
 void SnapVectorTowards(vec3_t v, vec3_t to);
 qboolean CheckGauntletAttack(gentity_t *ent);
+void G_StoreClientHistory(gentity_t *ent);
 void Weapon_HookFree (gentity_t *ent);
 void Weapon_HookThink (gentity_t *ent);
+void G_FlushBulletImpacts(void);
+
+
+// spawn point kinds, indexed by G_InitSpawnPoints
+typedef enum
+{
+	SPAWN_DEATHMATCH,
+	SPAWN_RED_BEGIN,
+	SPAWN_BLUE_BEGIN,
+	SPAWN_RED,
+	SPAWN_BLUE,
 
+	SPAWN_NUM_KINDS
+} spawnKind_t;
 
 //
 // g_client.c
@@ -644,6 +729,8 @@ void player_die (gentity_t *self, gentity_t *inflictor, gentity_t *attacker, int
 void AddScore(gentity_t *ent, vec3_t origin, int score);
 void CalculateRanks(void);
 qboolean SpotWouldTelefrag(gentity_t *spot);
+void G_InitSpawnPoints(void);
+gentity_t *G_SelectWaveSpawnPoint(spawnKind_t kind);
 
 //
 // g_svcmds.c
@@ -745,6 +832,9 @@ void G_RemoveQueuedBotBegin(int clientNum);
 qboolean G_BotConnect(int clientNum, qboolean restart);
 void Svcmd_AddBot_f(void);
 void Svcmd_BotList_f(void);
+void Svcmd_BotLoad_f(void);
+void G_BotLoadTime(int msec, qboolean game);
+int G_BotLoadThinkTime(void);
 void BotInterbreedEndMatch(void);
 
 // ai_main.c
@@ -820,6 +910,12 @@ extern	vmCvar_t	g_blueteam;
 extern	vmCvar_t	g_smoothClients;
 extern	vmCvar_t	pmove_fixed;
 extern	vmCvar_t	pmove_msec;
+extern	vmCvar_t	g_pmoveTraces;
+extern	vmCvar_t	g_thinkStats;
+extern	vmCvar_t	g_lagCompensation;
+extern	vmCvar_t	g_lagCompMaxMsec;
+extern	vmCvar_t	g_flameStream;
+extern	vmCvar_t	bot_frameBudget;
 extern	vmCvar_t	g_rankings;
 extern	vmCvar_t	g_enableDust;
 extern	vmCvar_t	g_enableBreath;
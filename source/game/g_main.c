@@ -15,6 +15,8 @@ typedef struct
 	int			modificationCount;  // for tracking changes
 	qboolean	trackChange;	    // track this variable, and announce if changed
   qboolean teamShader;        // track and if changed, update shader state
+	cvarUpdate_t	update;			// how often to look for changes
+	void		(*changed)(void);	// called when the value changed
 }
 cvarTable_t;
 
@@ -61,6 +63,12 @@ vmCvar_t	g_filterBan;
 vmCvar_t	g_smoothClients;
 vmCvar_t	pmove_fixed;
 vmCvar_t	pmove_msec;
+vmCvar_t	g_pmoveTraces;
+vmCvar_t	g_thinkStats;
+vmCvar_t	g_lagCompensation;
+vmCvar_t	g_lagCompMaxMsec;
+vmCvar_t	g_flameStream;
+vmCvar_t	bot_frameBudget;
 vmCvar_t	g_rankings;
 vmCvar_t	g_listEntity;
 #ifdef MISSIONPACK
@@ -86,14 +94,14 @@ static cvarTable_t gameCvarTable[] =
 	// noset vars
 	{ NULL, "gamename", GAMEVERSION , CVAR_SERVERINFO | CVAR_ROM, 0, qfalse  },
 	{ NULL, "gamedate", __DATE__ , CVAR_ROM, 0, qfalse  },
-	{ &g_restarted, "g_restarted", "0", CVAR_ROM, 0, qfalse  },
+	{ &g_restarted, "g_restarted", "0", CVAR_ROM, 0, qfalse, qfalse, CVU_DEMAND },
 	{ NULL, "sv_mapname", "", CVAR_SERVERINFO | CVAR_ROM, 0, qfalse  },
 
 	// latched vars
-	{ &g_gametype, "g_gametype", "5", CVAR_SERVERINFO | CVAR_USERINFO | CVAR_LATCH, 0, qfalse  },
+	{ &g_gametype, "g_gametype", "5", CVAR_SERVERINFO | CVAR_USERINFO | CVAR_LATCH, 0, qfalse, qfalse, CVU_DEMAND },
 
-	{ &g_maxclients, "sv_maxclients", "8", CVAR_SERVERINFO | CVAR_LATCH | CVAR_ARCHIVE, 0, qfalse  },
-	{ &g_maxGameClients, "g_maxGameClients", "0", CVAR_SERVERINFO | CVAR_LATCH | CVAR_ARCHIVE, 0, qfalse  },
+	{ &g_maxclients, "sv_maxclients", "8", CVAR_SERVERINFO | CVAR_LATCH | CVAR_ARCHIVE, 0, qfalse, qfalse, CVU_DEMAND },
+	{ &g_maxGameClients, "g_maxGameClients", "0", CVAR_SERVERINFO | CVAR_LATCH | CVAR_ARCHIVE, 0, qfalse, qfalse, CVU_DEMAND },
 
 	// change anytime vars
 	{ &g_dmflags, "dmflags", "0", CVAR_SERVERINFO | CVAR_ARCHIVE, 0, qtrue  },
@@ -101,7 +109,7 @@ static cvarTable_t gameCvarTable[] =
 	{ &g_timelimit, "timelimit", "0", CVAR_SERVERINFO | CVAR_ARCHIVE | CVAR_NORESTART, 0, qtrue },
 	{ &g_capturelimit, "capturelimit", "8", CVAR_SERVERINFO | CVAR_ARCHIVE | CVAR_NORESTART, 0, qtrue },
 
-	{ &g_synchronousClients, "g_synchronousClients", "0", CVAR_SYSTEMINFO, 0, qfalse  },
+	{ &g_synchronousClients, "g_synchronousClients", "0", CVAR_SYSTEMINFO, 0, qfalse, qfalse, CVU_FRAME },
 
 	{ &g_friendlyFire, "g_friendlyFire", "1", CVAR_ARCHIVE, 0, qtrue  },
 
@@ -117,9 +125,9 @@ static cvarTable_t gameCvarTable[] =
 	{ &g_banIPs, "g_banIPs", "", CVAR_ARCHIVE, 0, qfalse  },
 	{ &g_filterBan, "g_filterBan", "1", CVAR_ARCHIVE, 0, qfalse  },
 
-	{ &g_needpass, "g_needpass", "0", CVAR_SERVERINFO | CVAR_ROM, 0, qfalse },
+	{ &g_needpass, "g_needpass", "0", CVAR_SERVERINFO | CVAR_ROM, 0, qfalse, qfalse, CVU_DEMAND },
 
-	{ &g_dedicated, "dedicated", "0", 0, 0, qfalse  },
+	{ &g_dedicated, "dedicated", "0", 0, 0, qfalse, qfalse, CVU_DEMAND },
 
 	{ &g_speed, "g_speed", "320", 0, 0, qtrue  },
 	{ &g_gravity, "g_gravity", "800", 0, 0, qtrue  },
@@ -157,18 +165,24 @@ static cvarTable_t gameCvarTable[] =
 	{ &g_proxMineTimeout, "g_proxMineTimeout", "20000", 0, 0, qfalse },
 #endif
 	{ &g_smoothClients, "g_smoothClients", "1", 0, 0, qfalse},
-	{ &pmove_fixed, "pmove_fixed", "0", CVAR_SYSTEMINFO, 0, qfalse},
-	{ &pmove_msec, "pmove_msec", "8", CVAR_SYSTEMINFO, 0, qfalse},
+	{ &pmove_fixed, "pmove_fixed", "0", CVAR_SYSTEMINFO, 0, qfalse, qfalse, CVU_FRAME},
+	{ &pmove_msec, "pmove_msec", "8", CVAR_SYSTEMINFO, 0, qfalse, qfalse, CVU_FRAME},
+	{ &g_pmoveTraces, "g_pmoveTraces", "0", 0, 0, qfalse},
+	{ &g_thinkStats, "g_thinkStats", "0", 0, 0, qfalse},
+	{ &g_lagCompensation, "g_lagCompensation", "0", CVAR_SERVERINFO, 0, qfalse},
+	{ &g_lagCompMaxMsec, "g_lagCompMaxMsec", "300", CVAR_ARCHIVE, 0, qfalse},
+	{ &g_flameStream, "g_flameStream", "1", CVAR_ARCHIVE, 0, qfalse},
+	{ &bot_frameBudget, "bot_frameBudget", "0", 0, 0, qfalse},
 
 	{ &g_rankings, "g_rankings", "0", 0, 0, qfalse},
 
 	//Too: CVar Init
 	{ &g_InvSwapPeriod, "Inv_SwapPeriod", "3", CVAR_SERVERINFO | CVAR_ARCHIVE | CVAR_NORESTART, 0, qtrue },
-	{ &g_InvRoundTime, "Inv_RoundTime", "300", CVAR_SERVERINFO | CVAR_ARCHIVE | CVAR_NORESTART, 0, qtrue },
+	{ &g_InvRoundTime, "Inv_RoundTime", "300", CVAR_SERVERINFO | CVAR_ARCHIVE | CVAR_NORESTART, 0, qtrue, qfalse, CVU_SECOND, InvasionRoundTimeChanged },
 	{ &g_InvWarmUp, "Inv_WarmUp", "6", CVAR_ARCHIVE | CVAR_NORESTART, 0, qtrue },
 	{ &g_InvAnarchy, "Inv_Anarchy", "0", CVAR_SERVERINFO | CVAR_ARCHIVE | CVAR_NORESTART, 0, qtrue },
-	{ &g_InvEggHealth, "Inv_EggHealth", "40", CVAR_ARCHIVE | CVAR_NORESTART | CVAR_LATCH, 0, qtrue },
-	{ &g_InvAutoMode, "Inv_AutoMode", "1", CVAR_ARCHIVE | CVAR_NORESTART | CVAR_LATCH, 0, qtrue },
+	{ &g_InvEggHealth, "Inv_EggHealth", "40", CVAR_ARCHIVE | CVAR_NORESTART | CVAR_LATCH, 0, qtrue, qfalse, CVU_DEMAND },
+	{ &g_InvAutoMode, "Inv_AutoMode", "1", CVAR_ARCHIVE | CVAR_NORESTART | CVAR_LATCH, 0, qtrue, qfalse, CVU_DEMAND },
 
 };
 
@@ -191,6 +205,8 @@ This must be the very first function compiled into the .q3vm file
 */
 int vmMain(int command, int arg0, int arg1, int arg2, int arg3, int arg4, int arg5, int arg6, int arg7, int arg8, int arg9, int arg10, int arg11)
 {
+	int		start, ret;
+
 	switch (command)
 	{
 	case GAME_INIT:
@@ -217,12 +233,17 @@ int vmMain(int command, int arg0, int arg1, int arg2, int arg3, int arg4, int ar
 		ClientCommand(arg0);
 		return 0;
 	case GAME_RUN_FRAME:
+		start = trap_Milliseconds();
 		G_RunFrame(arg0);
+		G_BotLoadTime(trap_Milliseconds() - start, qtrue);
 		return 0;
 	case GAME_CONSOLE_COMMAND:
 		return ConsoleCommand();
 	case BOTAI_START_FRAME:
-		return BotAIStartFrame(arg0);
+		start = trap_Milliseconds();
+		ret = BotAIStartFrame(arg0);
+		G_BotLoadTime(trap_Milliseconds() - start, qfalse);
+		return ret;
 	}
 
 	return -1;
@@ -366,42 +387,83 @@ void G_RegisterCvars(void)
 		trap_Cvar_Set("g_gametype", "5");
 	}
 
-	level.RoundTimeModifCount = g_InvRoundTime.modificationCount;
 	level.InvWarmupModifCount = g_InvWarmUp.modificationCount;
 }
 
+/*
+=================
+G_UpdateCvar
+
+returns qtrue if the cvar changed
+=================
+*/
+static qboolean G_UpdateCvar(cvarTable_t *cv)
+{
+	trap_Cvar_Update(cv->vmCvar);
+
+	if (cv->modificationCount == cv->vmCvar->modificationCount)
+	{
+		return qfalse;
+	}
+	cv->modificationCount = cv->vmCvar->modificationCount;
+
+	if (cv->trackChange)
+	{
+		Inv_SendServerCommand(-1, va("print \"Server: %s changed to %s\n\"",
+			cv->cvarName, cv->vmCvar->string));
+	}
+
+	if (cv->changed)
+	{
+		cv->changed();
+	}
+	return qtrue;
+}
+
 /*
 =================
 G_UpdateCvars
+
+The per frame cvars are looked at every frame, the others a few per
+frame so that each of them is looked at about once a second.
 =================
 */
 void G_UpdateCvars(void)
 {
-	int			i;
+	static int	cursor;
+	static int	lastTime;
+	int			i, count;
 	cvarTable_t	*cv;
 	qboolean remapped = qfalse;
 
 	for (i = 0, cv = gameCvarTable; i < gameCvarTableSize; i++, cv++)
 	{
-		if (cv->vmCvar)
+		if (cv->vmCvar && cv->update == CVU_FRAME && G_UpdateCvar(cv) && cv->teamShader)
 		{
-			trap_Cvar_Update(cv->vmCvar);
-
-			if (cv->modificationCount != cv->vmCvar->modificationCount)
-			{
-				cv->modificationCount = cv->vmCvar->modificationCount;
-
-				if (cv->trackChange)
-				{
-					Inv_SendServerCommand(-1, va("print \"Server: %s changed to %s\n\"",
-						cv->cvarName, cv->vmCvar->string));
-				}
+			remapped = qtrue;
+		}
+	}
 
-				if (cv->teamShader)
-				{
-					remapped = qtrue;
-				}
-			}
+	if (level.time - lastTime >= 1000 || level.time < lastTime)
+	{
+		count = gameCvarTableSize;
+		lastTime = level.time;
+	}
+	else
+	{
+		count = gameCvarTableSize * (level.time - lastTime) / 1000;
+		lastTime += count * 1000 / gameCvarTableSize;
+	}
+	for (i = 0; i < count; i++)
+	{
+		if (cursor >= gameCvarTableSize)
+		{
+			cursor = 0;
+		}
+		cv = &gameCvarTable[cursor++];
+		if (cv->vmCvar && cv->update == CVU_SECOND && G_UpdateCvar(cv) && cv->teamShader)
+		{
+			remapped = qtrue;
 		}
 	}
 
@@ -437,6 +499,9 @@ void G_InitGame(int levelTime, int randomSeed, int restart)
 	memset(&level, 0, sizeof(level));
 	level.time = levelTime;
 	level.startTime = levelTime;
+	level.thinkWheelTime = levelTime;
+
+	G_InitConfigstringIndexes();
 
 	level.snd_fry = G_SoundIndex("sound/player/fry.wav");	// FIXME standing in lava / slime
 
@@ -505,6 +570,7 @@ void G_InitGame(int levelTime, int randomSeed, int restart)
 
 	// general initialization
 	G_FindTeams();
+	G_InitSpawnPoints();
 
 	// make sure we have flags for CTF, etc
 	if (g_gametype.integer >= GT_TEAM)
@@ -2044,9 +2110,87 @@ void G_RunThink (gentity_t *ent)
 	{
 		G_Error ("NULL ent->think");
 	}
+	level.frameThinks++;
 	ent->think (ent);
 }
 
+/*
+=============
+G_ThinkStats
+
+With g_thinkStats set, prints how many thinks ran and how many entities
+the frame loop visited per frame, every g_thinkStats seconds
+=============
+*/
+static void G_ThinkStats(void)
+{
+	thinkStats_t	*stats;
+
+	if (g_thinkStats.integer <= 0)
+	{
+		return;
+	}
+
+	stats = &level.thinkStats;
+	stats->frames++;
+	stats->thinks += level.frameThinks;
+	stats->visits += level.frameVisits;
+	if (level.frameThinks > stats->worst)
+	{
+		stats->worst = level.frameThinks;
+	}
+
+	if (level.time < level.thinkStatsTime)
+	{
+		return;
+	}
+	level.thinkStatsTime = level.time + g_thinkStats.integer * 1000;
+
+	G_Printf("think: %i frames, %.1f thinks/frame (worst %i), %.1f of %i entities visited/frame\n",
+		stats->frames, (float)stats->thinks / stats->frames, stats->worst,
+		(float)stats->visits / stats->frames, level.num_entities);
+	memset(stats, 0, sizeof(*stats));
+}
+
+/*
+=============
+G_EntityAtRest
+
+True when the frame loop has nothing left to do for the entity until
+something wakes it: no event and no think that the think wheel
+won't wake it for, and for items and physics
+objects, lying still on the ground.  Clients, missiles, flame streams and
+movers always stay on the active list.
+=============
+*/
+static qboolean G_EntityAtRest(gentity_t *ent)
+{
+	if (!ent->inuse || ent->client)
+	{
+		return qfalse;
+	}
+	if (ent->s.eType == ET_MISSILE || ent->s.eType == ET_MOVER || ent->s.eType == ET_FLAMESTREAM)
+	{
+		return qfalse;
+	}
+	if (ent->s.event || ent->freeAfterEvent || ent->unlinkAfterEvent)
+	{
+		return qfalse;
+	}
+	if (ent->nextthink > 0 && !ent->thinkPrev)
+	{
+		return qfalse;
+	}
+	if (ent->s.eType == ET_ITEM || ent->physicsObject)
+	{
+		if (ent->s.pos.trType != TR_STATIONARY || ent->s.groundEntityNum == -1)
+		{
+			return qfalse;
+		}
+	}
+	return qtrue;
+}
+
 /*
 ================
 G_RunFrame
@@ -2059,6 +2203,8 @@ void G_RunFrame(int levelTime)
 	int			i;
 	gentity_t	*ent;
 	int			msec;
+	static gentity_t	*missiles[MAX_GENTITIES];
+	int			numMissiles;
 int start, end;
 
 	// if we are waiting for the level to restart, do nothing
@@ -2079,11 +2225,29 @@ int start, end;
 	// go through all allocated objects
 	//
 	start = trap_Milliseconds();
+	numMissiles = 0;
+	level.frameThinks = 0;
+	level.frameVisits = 0;
+	G_RunThinkWheel();
 	ent = &g_entities[0];
 	for (i=0; i<level.num_entities; i++, ent++)
 	{
+		// resting entities are off the active list, skip them a word at a time
+		if (!(level.activeEntities[i >> 5] & (1u << (i & 31))))
+		{
+			if (!level.activeEntities[i >> 5])
+			{
+				i |= 31;
+				ent = &g_entities[i];
+			}
+			continue;
+		}
+
+		level.frameVisits++;
+
 		if (!ent->inuse)
 		{
+			G_SleepEntity(ent);
 			continue;
 		}
 
@@ -2126,15 +2290,19 @@ int start, end;
 			continue;
 		}
 
-		if (ent->s.eType == ET_MISSILE)
+		if (ent->s.eType == ET_MISSILE || ent->s.eType == ET_FLAMESTREAM)
 		{
-			G_RunMissile(ent);
+			missiles[numMissiles++] = ent;
 			continue;
 		}
 
 		if (ent->s.eType == ET_ITEM || ent->physicsObject)
 		{
 			G_RunItem(ent);
+			if (G_EntityAtRest(ent))
+			{
+				G_SleepEntity(ent);
+			}
 			continue;
 		}
 
@@ -2152,7 +2320,15 @@ int start, end;
 		}
 
 		G_RunThink(ent);
+		if (G_EntityAtRest(ent))
+		{
+			G_SleepEntity(ent);
+		}
 	}
+
+	// missiles go last, against everything in its new place
+	G_RunMissiles(missiles, numMissiles);
+	G_ThinkStats();
 end = trap_Milliseconds();
 
 start = trap_Milliseconds();
@@ -2167,6 +2343,9 @@ start = trap_Milliseconds();
 	}
 end = trap_Milliseconds();
 
+	// send the bullet impacts of the frame, merged per shooter
+	G_FlushBulletImpacts();
+
 	// see if it is time to do a tournement restart
 	CheckTournament();
 
@@ -2174,7 +2353,7 @@ end = trap_Milliseconds();
 	CheckExitRules();
 
 	// update to team status?
-	//CheckTeamStatus();
+	CheckTeamStatus();
 
 	// cancel vote if timed out
 	CheckVote();
@@ -2228,6 +2407,7 @@ end = trap_Milliseconds();
 			G_Printf("%4i: %s\n", i, g_entities[i].classname);
 		}
 		trap_Cvar_Set("g_listEntity", "0");
+		trap_Cvar_Update(&g_listEntity);
 	}
 }
 
@@ -220,7 +220,7 @@ void SP_misc_portal_surface(gentity_t *ent)
 	else
 	{
 		ent->think = locateCamera;
-		ent->nextthink = level.time + 100;
+		G_SetNextThink(ent, level.time + 100);
 	}
 }
 
@@ -302,7 +302,7 @@ static void InitShooter_Finish(gentity_t *ent)
 {
 	ent->enemy = G_PickTarget(ent->target);
 	ent->think = 0;
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 void InitShooter(gentity_t *ent, int weapon)
@@ -323,7 +323,7 @@ void InitShooter(gentity_t *ent, int weapon)
 	if (ent->target)
 	{
 		ent->think = InitShooter_Finish;
-		ent->nextthink = level.time + 500;
+		G_SetNextThink(ent, level.time + 500);
 	}
 	trap_LinkEntity(ent);
 }
@@ -399,7 +399,7 @@ void DropPortalDestination(gentity_t *player)
 	VectorCopy(player->s.apos.trBase, ent->s.angles);
 
 	ent->think = G_FreeEntity;
-	ent->nextthink = level.time + 2 * 60 * 1000;
+	G_SetNextThink(ent, level.time + 2 * 60 * 1000);
 
 	trap_LinkEntity(ent);
 
@@ -471,7 +471,7 @@ static void PortalEnable(gentity_t *self)
 {
 	self->touch = PortalTouch;
 	self->think = G_FreeEntity;
-	self->nextthink = level.time + 2 * 60 * 1000;
+	G_SetNextThink(self, level.time + 2 * 60 * 1000);
 }
 
 
@@ -506,7 +506,7 @@ void DropPortalSource(gentity_t *player)
 
 //	ent->spawnflags = player->client->ps.persistant[PERS_TEAM];
 
-	ent->nextthink = level.time + 1000;
+	G_SetNextThink(ent, level.time + 1000);
 	ent->think = PortalEnable;
 
 	// find the destination
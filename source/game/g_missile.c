@@ -111,7 +111,7 @@ ProximityMine_Die
 static void ProximityMine_Die(gentity_t *ent, gentity_t *inflictor, gentity_t *attacker, int damage, int mod)
 {
 	ent->think = ProximityMine_Explode;
-	ent->nextthink = level.time + 1;
+	G_SetNextThink(ent, level.time + 1);
 }
 
 /*
@@ -156,7 +156,7 @@ void ProximityMine_Trigger(gentity_t *trigger, gentity_t *other, trace_t *trace)
 	mine = trigger->parent;
 	mine->s.loopSound = 0;
 	G_AddEvent(mine, EV_PROXIMITY_MINE_TRIGGER, 0);
-	mine->nextthink = level.time + 500;
+	G_SetNextThink(mine, level.time + 500);
 
 	G_FreeEntity(trigger);
 }
@@ -172,7 +172,7 @@ static void ProximityMine_Activate(gentity_t *ent)
 	float		r;
 
 	ent->think = ProximityMine_Explode;
-	ent->nextthink = level.time + g_proxMineTimeout.integer;
+	G_SetNextThink(ent, level.time + g_proxMineTimeout.integer);
 
 	ent->takedamage = qtrue;
 	ent->health = 1;
@@ -248,7 +248,7 @@ static void ProximityMine_Player(gentity_t *mine, gentity_t *player)
 		player->activator->splashDamage += mine->splashDamage;
 		player->activator->splashRadius *= 1.50;
 		mine->think = G_FreeEntity;
-		mine->nextthink = level.time;
+		G_SetNextThink(mine, level.time);
 		return;
 	}
 
@@ -264,11 +264,11 @@ static void ProximityMine_Player(gentity_t *mine, gentity_t *player)
 	mine->think = ProximityMine_ExplodeOnPlayer;
 	if (player->client->invulnerabilityTime > level.time)
 	{
-		mine->nextthink = level.time + 2 * 1000;
+		G_SetNextThink(mine, level.time + 2 * 1000);
 	}
 	else
 	{
-		mine->nextthink = level.time + 10 * 1000;
+		G_SetNextThink(mine, level.time + 10 * 1000);
 	}
 }
 #endif
@@ -378,7 +378,7 @@ void G_MissileImpact(gentity_t *ent, trace_t *trace)
 		G_AddEvent(ent, EV_PROXIMITY_MINE_STICK, trace->surfaceFlags);
 
 		ent->think = ProximityMine_Activate;
-		ent->nextthink = level.time + 2000;
+		G_SetNextThink(ent, level.time + 2000);
 
 		vectoangles(trace->plane.normal, ent->s.angles);
 		ent->s.angles[0] += 90;
@@ -469,7 +469,7 @@ void G_MissileImpact(gentity_t *ent, trace_t *trace)
 		G_SetOrigin(nent, v);
 
 		ent->think = Weapon_HookThink;
-		ent->nextthink = level.time + FRAMETIME;
+		G_SetNextThink(ent, level.time + FRAMETIME);
 
 		ent->parent->client->ps.pm_flags |= PMF_GRAPPLE_PULL;
 		VectorCopy(ent->r.currentOrigin, ent->parent->client->ps.grapplePoint);
@@ -524,12 +524,350 @@ void G_MissileImpact(gentity_t *ent, trace_t *trace)
 	trap_LinkEntity(ent);
 }
 
+/*
+===============================================================================
+
+MISSILE BROADPHASE
+
+Missiles run as one batch after everything else has moved. Before the
+batch, every linked entity a missile could hit is put in a coarse grid,
+so a missile can tell when there is nothing but the world around it.
+
+Linear missiles trace their path against the world once, ahead of
+time. While a missile is on the clear part of that path and no entity
+is near, it moves without a trace. It is only relinked once it leaves
+the box it was last linked with, which is stretched along its flight.
+
+===============================================================================
+*/
+
+#define MISSILE_GRID_SIZE		256		// units per grid cell
+#define MISSILE_GRID_BUCKETS	256		// must be a power of two
+#define MISSILE_GRID_NODES		(MAX_GENTITIES * 4)
+#define MISSILE_GRID_MAXCELLS	4		// entities on more cells are checked by every missile
+#define MISSILE_QUERY_MAXCELLS	16		// missiles sweeping more cells trace normally
+
+#define MISSILE_CLEAR_MSEC		2000	// how far ahead the world path is traced
+#define MISSILE_LINK_MSEC		200		// how far ahead a moving missile is linked
+#define MISSILE_LINK_PAD		256		// at most this much in any direction
+
+static int		missileBuckets[MISSILE_GRID_BUCKETS];	// first node, -1 for none
+static int		missileNodeEnt[MISSILE_GRID_NODES];
+static int		missileNodeNext[MISSILE_GRID_NODES];
+static int		missileNumNodes;
+static int		missileBig[MAX_GENTITIES];
+static int		missileNumBig;
+
+static int G_MissileGridCell(float f)
+{
+	return (int)floor(f * (1.0f / MISSILE_GRID_SIZE));
+}
+
+static int G_MissileGridBucket(int x, int y)
+{
+	return (x * 73856093 ^ y * 19349663) & (MISSILE_GRID_BUCKETS-1);
+}
+
+/*
+================
+G_BuildMissileGrid
+================
+*/
+static void G_BuildMissileGrid(void)
+{
+	gentity_t	*ent;
+	int			i, x, y, x0, y0, x1, y1, b;
+
+	for (i = 0; i < MISSILE_GRID_BUCKETS; i++)
+	{
+		missileBuckets[i] = -1;
+	}
+	missileNumNodes = 0;
+	missileNumBig = 0;
+
+	for (i = 0, ent = g_entities; i < level.num_entities; i++, ent++)
+	{
+		if (!ent->inuse || !ent->r.linked || !ent->r.contents)
+		{
+			continue;
+		}
+
+		x0 = G_MissileGridCell(ent->r.absmin[0]);
+		y0 = G_MissileGridCell(ent->r.absmin[1]);
+		x1 = G_MissileGridCell(ent->r.absmax[0]);
+		y1 = G_MissileGridCell(ent->r.absmax[1]);
+
+		if ((x1 - x0 + 1) * (y1 - y0 + 1) > MISSILE_GRID_MAXCELLS
+			|| missileNumNodes + MISSILE_GRID_MAXCELLS > MISSILE_GRID_NODES)
+		{
+			missileBig[missileNumBig++] = i;
+			continue;
+		}
+
+		for (x = x0; x <= x1; x++)
+		{
+			for (y = y0; y <= y1; y++)
+			{
+				b = G_MissileGridBucket(x, y);
+				missileNodeEnt[missileNumNodes] = i;
+				missileNodeNext[missileNumNodes] = missileBuckets[b];
+				missileBuckets[b] = missileNumNodes++;
+			}
+		}
+	}
+}
+
+/*
+================
+G_MissileTouches
+
+Would a trace of the missile through mins/maxs have to test this entity
+================
+*/
+static qboolean G_MissileTouches(gentity_t *ent, gentity_t *other, const vec3_t mins, const vec3_t maxs, int passent)
+{
+	// entities can go away during the batch
+	if (!other->inuse || !other->r.linked)
+	{
+		return qfalse;
+	}
+	// trap_Trace skips these too
+	if (other->s.number == passent || other->r.ownerNum == passent)
+	{
+		return qfalse;
+	}
+	if (!(other->r.contents & ent->clipmask))
+	{
+		return qfalse;
+	}
+	if (other->r.absmin[0] > maxs[0] || other->r.absmin[1] > maxs[1] || other->r.absmin[2] > maxs[2]
+		|| other->r.absmax[0] < mins[0] || other->r.absmax[1] < mins[1] || other->r.absmax[2] < mins[2])
+	{
+		return qfalse;
+	}
+	return qtrue;
+}
+
+/*
+================
+G_MissileNearEntity
+
+Is there anything but the world in the box the missile sweeps this frame
+================
+*/
+static qboolean G_MissileNearEntity(gentity_t *ent, const vec3_t mins, const vec3_t maxs, int passent)
+{
+	int		i, x, y, x0, y0, x1, y1, n;
+
+	for (i = 0; i < missileNumBig; i++)
+	{
+		if (G_MissileTouches(ent, &g_entities[missileBig[i]], mins, maxs, passent))
+		{
+			return qtrue;
+		}
+	}
+
+	x0 = G_MissileGridCell(mins[0]);
+	y0 = G_MissileGridCell(mins[1]);
+	x1 = G_MissileGridCell(maxs[0]);
+	y1 = G_MissileGridCell(maxs[1]);
+
+	if ((x1 - x0 + 1) * (y1 - y0 + 1) > MISSILE_QUERY_MAXCELLS)
+	{
+		return qtrue;
+	}
+
+	for (x = x0; x <= x1; x++)
+	{
+		for (y = y0; y <= y1; y++)
+		{
+			for (n = missileBuckets[G_MissileGridBucket(x, y)]; n >= 0; n = missileNodeNext[n])
+			{
+				if (G_MissileTouches(ent, &g_entities[missileNodeEnt[n]], mins, maxs, passent))
+				{
+					return qtrue;
+				}
+			}
+		}
+	}
+	return qfalse;
+}
+
+/*
+================
+G_MissileTraceAhead
+
+Traces the straight path of the missile against the world, players and
+corpses are left to the grid. The path is clear until missileClearTime.
+================
+*/
+static void G_MissileTraceAhead(gentity_t *ent, int passent)
+{
+	trace_t		tr;
+	vec3_t		end, ofs;
+	float		speed, startTime, endTime;
+
+	ent->missileClearTrTime = ent->s.pos.trTime;
+	ent->missileClearOpen = qfalse;
+	ent->missileClearTime = -1;
+
+	speed = DotProduct(ent->s.pos.trDelta, ent->s.pos.trDelta);
+	if (speed <= 0)
+	{
+		return;
+	}
+
+	// when the missile was where it is now
+	VectorSubtract(ent->r.currentOrigin, ent->s.pos.trBase, ofs);
+	startTime = ent->s.pos.trTime + 1000 * DotProduct(ofs, ent->s.pos.trDelta) / speed;
+	endTime = level.time + MISSILE_CLEAR_MSEC;
+	BG_EvaluateTrajectory(&ent->s.pos, endTime, end);
+
+	trap_Trace(&tr, ent->r.currentOrigin, ent->r.mins, ent->r.maxs, end, passent,
+				ent->clipmask & ~(CONTENTS_BODY|CONTENTS_CORPSE));
+	if (tr.startsolid || tr.allsolid)
+	{
+		return;
+	}
+
+	if (tr.fraction == 1)
+	{
+		ent->missileClearTime = endTime;
+		ent->missileClearOpen = qtrue;
+	}
+	else
+	{
+		ent->missileClearTime = (int)(startTime + tr.fraction * (endTime - startTime)) - 1;
+	}
+}
+
+/*
+================
+G_MissilePathClear
+
+Can the missile move to origin without a trace
+================
+*/
+static qboolean G_MissilePathClear(gentity_t *ent, const vec3_t origin, int passent)
+{
+	vec3_t	mins, maxs;
+	int		i;
+
+	if (ent->s.pos.trType != TR_LINEAR)
+	{
+		return qfalse;
+	}
+
+	// bounces restart the trajectory
+	if (!ent->missileClearTime || ent->missileClearTrTime != ent->s.pos.trTime
+		|| (ent->missileClearOpen && level.time > ent->missileClearTime))
+	{
+		G_MissileTraceAhead(ent, passent);
+	}
+
+	if (level.time > ent->missileClearTime)
+	{
+		return qfalse;
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		if (origin[i] < ent->r.currentOrigin[i])
+		{
+			mins[i] = origin[i] + ent->r.mins[i];
+			maxs[i] = ent->r.currentOrigin[i] + ent->r.maxs[i];
+		}
+		else
+		{
+			mins[i] = ent->r.currentOrigin[i] + ent->r.mins[i];
+			maxs[i] = origin[i] + ent->r.maxs[i];
+		}
+	}
+	return !G_MissileNearEntity(ent, mins, maxs, passent);
+}
+
+/*
+================
+G_LinkMissile
+
+A moving missile is linked with its box stretched along its flight, and
+not linked again until it leaves that box. This only makes the box used
+for snapshots and area queries bigger, never smaller.
+================
+*/
+static void G_LinkMissile(gentity_t *ent)
+{
+	vec3_t	mins, maxs, oldMins, oldMaxs;
+	float	pad;
+	int		i;
+
+	if (ent->r.linked)
+	{
+		for (i = 0; i < 3; i++)
+		{
+			if (ent->r.currentOrigin[i] + ent->r.mins[i] < ent->r.absmin[i]
+				|| ent->r.currentOrigin[i] + ent->r.maxs[i] > ent->r.absmax[i])
+			{
+				break;
+			}
+			// stopped missiles want an exact box, absmin has a one unit pad
+			if (ent->s.pos.trType == TR_STATIONARY
+				&& (ent->r.currentOrigin[i] + ent->r.mins[i] > ent->r.absmin[i] + 1.5f
+					|| ent->r.currentOrigin[i] + ent->r.maxs[i] < ent->r.absmax[i] - 1.5f))
+			{
+				break;
+			}
+		}
+		if (i == 3)
+		{
+			return;
+		}
+	}
+
+	if (ent->s.pos.trType == TR_STATIONARY)
+	{
+		trap_LinkEntity(ent);
+		return;
+	}
+
+	VectorCopy(ent->r.mins, oldMins);
+	VectorCopy(ent->r.maxs, oldMaxs);
+	VectorCopy(ent->r.mins, mins);
+	VectorCopy(ent->r.maxs, maxs);
+	for (i = 0; i < 3; i++)
+	{
+		pad = ent->s.pos.trDelta[i] * (MISSILE_LINK_MSEC * 0.001f);
+		if (pad > MISSILE_LINK_PAD)
+		{
+			pad = MISSILE_LINK_PAD;
+		}
+		else if (pad < -MISSILE_LINK_PAD)
+		{
+			pad = -MISSILE_LINK_PAD;
+		}
+		if (pad > 0)
+		{
+			maxs[i] += pad;
+		}
+		else
+		{
+			mins[i] += pad;
+		}
+	}
+
+	VectorCopy(mins, ent->r.mins);
+	VectorCopy(maxs, ent->r.maxs);
+	trap_LinkEntity(ent);
+	VectorCopy(oldMins, ent->r.mins);
+	VectorCopy(oldMaxs, ent->r.maxs);
+}
+
 /*
 ================
 G_RunMissile
 ================
 */
-void G_RunMissile(gentity_t *ent)
+static void G_RunMissile(gentity_t *ent)
 {
 	vec3_t		origin;
 	trace_t		tr;
@@ -555,21 +893,30 @@ void G_RunMissile(gentity_t *ent)
 		// ignore interactions with the missile owner
 		passent = ent->r.ownerNum;
 	}
-	// trace a line from the previous position to the current position
-	trap_Trace(&tr, ent->r.currentOrigin, ent->r.mins, ent->r.maxs, origin, passent, ent->clipmask);
 
-	if (tr.startsolid || tr.allsolid)
+	if (G_MissilePathClear(ent, origin, passent))
 	{
-		// make sure the tr.entityNum is set to the entity we're stuck in
-		trap_Trace(&tr, ent->r.currentOrigin, ent->r.mins, ent->r.maxs, ent->r.currentOrigin, passent, ent->clipmask);
-		tr.fraction = 0;
+		VectorCopy(origin, ent->r.currentOrigin);
+		tr.fraction = 1;
 	}
 	else
 	{
-		VectorCopy(tr.endpos, ent->r.currentOrigin);
+		// trace a line from the previous position to the current position
+		trap_Trace(&tr, ent->r.currentOrigin, ent->r.mins, ent->r.maxs, origin, passent, ent->clipmask);
+
+		if (tr.startsolid || tr.allsolid)
+		{
+			// make sure the tr.entityNum is set to the entity we're stuck in
+			trap_Trace(&tr, ent->r.currentOrigin, ent->r.mins, ent->r.maxs, ent->r.currentOrigin, passent, ent->clipmask);
+			tr.fraction = 0;
+		}
+		else
+		{
+			VectorCopy(tr.endpos, ent->r.currentOrigin);
+		}
 	}
 
-	trap_LinkEntity(ent);
+	G_LinkMissile(ent);
 
 	if (tr.fraction != 1)
 	{
@@ -606,6 +953,46 @@ void G_RunMissile(gentity_t *ent)
 	G_RunThink(ent);
 }
 
+static void G_RunFlameStream(gentity_t *ent);
+
+/*
+================
+G_RunMissiles
+
+Runs the missiles G_RunFrame collected, after everything else moved
+================
+*/
+void G_RunMissiles(gentity_t **missiles, int numMissiles)
+{
+	gentity_t	*ent;
+	int			i;
+
+	if (!numMissiles)
+	{
+		return;
+	}
+
+	G_BuildMissileGrid();
+
+	for (i = 0; i < numMissiles; i++)
+	{
+		ent = missiles[i];
+		// an earlier missile can take out a later one
+		if (!ent->inuse)
+		{
+			continue;
+		}
+		if (ent->s.eType == ET_FLAMESTREAM)
+		{
+			G_RunFlameStream(ent);
+		}
+		else if (ent->s.eType == ET_MISSILE)
+		{
+			G_RunMissile(ent);
+		}
+	}
+}
+
 
 //=============================================================================
 
@@ -623,7 +1010,7 @@ gentity_t *fire_plasma(gentity_t *self, vec3_t start, vec3_t dir, int Parm)
 
 	bolt = G_Spawn();
 	bolt->classname = "plasma";
-	bolt->nextthink = level.time + 10000;
+	G_SetNextThink(bolt, level.time + 10000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -682,7 +1069,7 @@ void G_FlameThink(gentity_t *ent)
 	radius += 12;		//Too: bonus
 	G_RadiusDamage(ent->r.currentOrigin, ent->parent, ent->damage, radius, NULL, MOD_FLAME, 0, qtrue);
 
-	ent->nextthink += 175;
+	G_SetNextThink(ent, ent->nextthink + 175);
 }
 
 /*
@@ -711,7 +1098,7 @@ gentity_t *fire_Flame(gentity_t *self, vec3_t start, vec3_t dir, int Parm)
 	//if (!MulMove)
 	if (Parm & ~WP_FIRE2BIT)		//Too: if actually uses ammo
 	{
-		bolt->nextthink = level.time + 175;//es_FlameTime;
+		G_SetNextThink(bolt, level.time + 175);//es_FlameTime;
 		bolt->think = G_FlameThink;//G_FreeEntity;
 		bolt->s.eType = ET_MISSILE;
 		bolt->damage = 30;
@@ -720,7 +1107,7 @@ gentity_t *fire_Flame(gentity_t *self, vec3_t start, vec3_t dir, int Parm)
 	}
 	else
 	{
-		bolt->nextthink = level.time + es_FlameTime;
+		G_SetNextThink(bolt, level.time + es_FlameTime);
 		bolt->think = G_FreeEntity;
 		bolt->s.eType = ET_MISSILE;
 		bolt->damage = 0;
@@ -751,6 +1138,412 @@ gentity_t *fire_Flame(gentity_t *self, vec3_t start, vec3_t dir, int Parm)
 	return bolt;
 }
 
+/*
+===============================================================================
+
+FLAME STREAMS
+
+A flamethrower used to spawn a missile for every puff, so a player
+holding fire kept a couple of dozen entities alive, each one sent and
+traced on its own. Now every player has a single stream entity that
+owns the puffs. It moves them all in one pass, with the same hits,
+burns and events the flame missiles had, and only sends the two newest
+puffs. cgame rebuilds the rest of the stream from those.
+
+===============================================================================
+*/
+
+typedef struct
+{
+	int			time;			// trTime of the puff, 0 when it is out
+	int			fireTime;		// level.time it was fired at
+	int			nextBurn;		// next radius damage, 0 if it doesn't burn
+	int			clearTime;		// the world is clear of its path until then
+	int			damage;
+	int			splashDamage;
+	vec3_t		base;
+	vec3_t		delta;
+	vec3_t		origin;			// where it was moved to last
+} flamePuff_t;
+
+typedef struct
+{
+	gentity_t	*ent;
+	int			count;			// puffs fired this level
+	flamePuff_t	puffs[FLAME_STREAM_PUFFS];
+} flameStream_t;
+
+static flameStream_t	flameStreams[MAX_CLIENTS];
+
+/*
+================
+G_FlameStreamEntity
+
+Returns the stream of a client, spawning it when it has none
+================
+*/
+static gentity_t *G_FlameStreamEntity(gentity_t *self)
+{
+	flameStream_t	*fs = &flameStreams[self->s.number];
+	gentity_t		*ent = fs->ent;
+
+	if (ent && ent->inuse && ent->s.eType == ET_FLAMESTREAM && ent->s.otherEntityNum == self->s.number)
+	{
+		return ent;
+	}
+
+	memset(fs->puffs, 0, sizeof(fs->puffs));
+
+	ent = G_Spawn();
+	ent->classname = "flamestream";
+	ent->s.eType = ET_FLAMESTREAM;
+	ent->s.weapon = WP_FLAMETHROWER;
+	ent->s.otherEntityNum = self->s.number;
+	ent->s.time2 = fs->count;
+	ent->r.svFlags = SVF_USE_CURRENT_ORIGIN;
+	ent->r.ownerNum = self->s.number;
+	ent->parent = self;
+
+	ent->splashRadius = es_FlameMulRadius * 0.5f;
+	ent->methodOfDeath = MOD_FLAME;
+	ent->splashMethodOfDeath = MOD_FLAME_SPLASH;
+	ent->clipmask = MASK_SHOT;
+
+	fs->ent = ent;
+	return ent;
+}
+
+/*
+================
+G_LinkFlameStream
+
+Links the stream with a box around all its puffs and their flames
+================
+*/
+static void G_LinkFlameStream(gentity_t *ent)
+{
+	flameStream_t	*fs = &flameStreams[ent->s.otherEntityNum];
+	flamePuff_t		*puff;
+	vec3_t			mins, maxs;
+	qboolean		first = qtrue;
+	int				i, j;
+
+	for (i = 0, puff = fs->puffs; i < FLAME_STREAM_PUFFS; i++, puff++)
+	{
+		if (!puff->time)
+		{
+			continue;
+		}
+		if (first)
+		{
+			VectorCopy(puff->origin, mins);
+			VectorCopy(puff->origin, maxs);
+			first = qfalse;
+			continue;
+		}
+		for (j = 0; j < 3; j++)
+		{
+			if (puff->origin[j] < mins[j])
+			{
+				mins[j] = puff->origin[j];
+			}
+			else if (puff->origin[j] > maxs[j])
+			{
+				maxs[j] = puff->origin[j];
+			}
+		}
+	}
+	if (first)
+	{
+		trap_UnlinkEntity(ent);
+		return;
+	}
+
+	VectorCopy(ent->s.pos.trBase, ent->r.currentOrigin);
+	for (j = 0; j < 3; j++)
+	{
+		ent->r.mins[j] = mins[j] - ent->r.currentOrigin[j] - (es_FlameMulRadius + es_FlameBaseRadius);
+		ent->r.maxs[j] = maxs[j] - ent->r.currentOrigin[j] + (es_FlameMulRadius + es_FlameBaseRadius);
+	}
+	trap_LinkEntity(ent);
+}
+
+/*
+================
+G_FlamePuffTraceAhead
+
+Traces the whole flight of a puff against the world, once
+================
+*/
+static void G_FlamePuffTraceAhead(gentity_t *ent, flamePuff_t *puff)
+{
+	trace_t		tr;
+	vec3_t		end;
+	int			endTime;
+
+	endTime = puff->fireTime + es_FlameTime + FLAME_BURN_MSEC;
+	VectorMA(puff->base, (endTime - puff->time) * 0.001f, puff->delta, end);
+
+	trap_Trace(&tr, puff->base, NULL, NULL, end, ent->r.ownerNum,
+				ent->clipmask & ~(CONTENTS_BODY|CONTENTS_CORPSE));
+	if (tr.startsolid || tr.allsolid)
+	{
+		puff->clearTime = -1;
+	}
+	else if (tr.fraction == 1)
+	{
+		puff->clearTime = endTime;
+	}
+	else
+	{
+		puff->clearTime = (int)(puff->time + tr.fraction * (endTime - puff->time)) - 1;
+	}
+}
+
+/*
+================
+G_FlamePuffImpact
+
+What G_MissileImpact did for a flame missile
+================
+*/
+static void G_FlamePuffImpact(gentity_t *ent, flamePuff_t *puff, trace_t *trace)
+{
+	gentity_t	*other = &g_entities[trace->entityNum];
+	gentity_t	*owner = &g_entities[ent->r.ownerNum];
+	gentity_t	*te;
+	qboolean	hitClient = qfalse;
+	vec3_t		origin;
+	int			event;
+
+	if (other->takedamage && puff->damage)
+	{
+		if (LogAccuracyHit(other, owner))
+		{
+			owner->client->accuracy_hits++;
+			hitClient = qtrue;
+		}
+		G_Damage(other, ent, owner, puff->delta, puff->origin, puff->damage, 0, ent->methodOfDeath);
+	}
+
+	if (other->takedamage && other->client)
+	{
+		event = EV_MISSILE_HIT;
+	}
+	else if (!puff->damage)
+	{
+		event = 0;
+	}
+	else if (trace->surfaceFlags & SURF_METALSTEPS)
+	{
+		event = EV_MISSILE_MISS_METAL;
+	}
+	else
+	{
+		event = EV_MISSILE_MISS;
+	}
+
+	if (event)
+	{
+		VectorCopy(trace->endpos, origin);
+		SnapVectorTowards(origin, puff->base);	// save net bandwidth
+		te = G_TempEntity(origin, event);
+		te->s.weapon = WP_FLAMETHROWER;
+		te->s.eventParm = DirToByte(trace->plane.normal);
+		te->s.otherEntityNum = (event == EV_MISSILE_HIT) ? other->s.number : owner->s.number;
+	}
+
+	// splash damage (doesn't apply to person directly hit)
+	if (puff->splashDamage)
+	{
+		if (G_RadiusDamage(trace->endpos, owner, puff->splashDamage, ent->splashRadius,
+			other, ent->splashMethodOfDeath, 0, qtrue))
+		{
+			if (!hitClient)
+			{
+				owner->client->accuracy_hits++;
+			}
+		}
+	}
+}
+
+/*
+================
+G_RunFlamePuff
+
+Moves a puff like G_RunMissile, then burns like G_FlameThink
+================
+*/
+static void G_RunFlamePuff(gentity_t *ent, flamePuff_t *puff)
+{
+	vec3_t		origin, mins, maxs;
+	trace_t		tr;
+	int			i, delta, radius;
+
+	// puffs that don't burn go out when their time is up, burning ones on their next burn
+	if (!puff->nextBurn && level.time >= puff->fireTime + es_FlameTime)
+	{
+		puff->time = 0;
+		return;
+	}
+
+	VectorMA(puff->base, (level.time - puff->time) * 0.001f, puff->delta, origin);
+
+	if (!puff->clearTime)
+	{
+		G_FlamePuffTraceAhead(ent, puff);
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		mins[i] = (origin[i] < puff->origin[i]) ? origin[i] : puff->origin[i];
+		maxs[i] = (origin[i] < puff->origin[i]) ? puff->origin[i] : origin[i];
+	}
+
+	if (level.time <= puff->clearTime && !G_MissileNearEntity(ent, mins, maxs, ent->r.ownerNum))
+	{
+		VectorCopy(origin, puff->origin);
+	}
+	else
+	{
+		trap_Trace(&tr, puff->origin, NULL, NULL, origin, ent->r.ownerNum, ent->clipmask);
+		if (tr.startsolid || tr.allsolid)
+		{
+			// make sure the tr.entityNum is set to the entity we're stuck in
+			trap_Trace(&tr, puff->origin, NULL, NULL, puff->origin, ent->r.ownerNum, ent->clipmask);
+			tr.fraction = 0;
+		}
+		else
+		{
+			VectorCopy(tr.endpos, puff->origin);
+		}
+
+		if (tr.fraction != 1)
+		{
+			// never burn on sky
+			if (!(tr.surfaceFlags & SURF_NOIMPACT))
+			{
+				G_FlamePuffImpact(ent, puff, &tr);
+			}
+			puff->time = 0;
+			return;
+		}
+	}
+
+	if (!puff->nextBurn || level.time < puff->nextBurn)
+	{
+		return;
+	}
+
+	delta = level.time - (puff->time + es_FlamePreStep);
+	if (delta >= es_FlameTime)
+	{
+		puff->time = 0;
+		return;
+	}
+
+	radius = (es_FlameMulRadius * Square((float)delta / es_FlameTime)) + es_FlameBaseRadius;
+	radius += 12;		//Too: bonus
+	G_RadiusDamage(puff->origin, &g_entities[ent->r.ownerNum], puff->damage, radius, NULL, MOD_FLAME, 0, qtrue);
+
+	puff->nextBurn += FLAME_BURN_MSEC;
+}
+
+/*
+================
+G_RunFlameStream
+
+Runs every puff of a stream, the stream goes away with its last puff
+================
+*/
+static void G_RunFlameStream(gentity_t *ent)
+{
+	flameStream_t	*fs = &flameStreams[ent->s.otherEntityNum];
+	gentity_t		*owner = &g_entities[ent->s.otherEntityNum];
+	flamePuff_t		*puff;
+	qboolean		live = qfalse;
+	int				i;
+
+	if (fs->ent == ent && owner->inuse && owner->client)
+	{
+		for (i = 0, puff = fs->puffs; i < FLAME_STREAM_PUFFS; i++, puff++)
+		{
+			if (puff->time)
+			{
+				G_RunFlamePuff(ent, puff);
+			}
+			if (puff->time)
+			{
+				live = qtrue;
+			}
+		}
+	}
+
+	if (!live)
+	{
+		if (fs->ent == ent)
+		{
+			fs->ent = NULL;
+		}
+		G_FreeEntity(ent);
+		return;
+	}
+
+	G_LinkFlameStream(ent);
+}
+
+/*
+=================
+fire_FlameStream
+
+Adds a puff to the stream of self, with what fire_Flame would have
+given the flame missile
+=================
+*/
+void fire_FlameStream(gentity_t *self, vec3_t start, vec3_t dir, int Parm, float damageScale)
+{
+	gentity_t	*ent;
+	flamePuff_t	*puff;
+	float		Speed = 500;
+	int			MulMove = ((Parm >> 3) & 3);
+	int			burning = (Parm & ~WP_FIRE2BIT) ? 1 : 0;		//Too: if actually uses ammo
+
+	if (Parm & WP_FIRE2BIT)
+		Speed *= 0.5;
+
+	VectorNormalize (dir);
+
+	ent = G_FlameStreamEntity(self);
+	puff = &flameStreams[self->s.number].puffs[flameStreams[self->s.number].count % FLAME_STREAM_PUFFS];
+	flameStreams[self->s.number].count++;
+
+	memset(puff, 0, sizeof(*puff));
+	puff->time = level.time - es_FlamePreStep - es_FlameThrowerTick * MulMove;		// move a bit on the very first frame
+	puff->fireTime = level.time;
+	if (burning)
+	{
+		puff->nextBurn = level.time + FLAME_BURN_MSEC;
+		puff->damage = 30 * damageScale;
+		puff->splashDamage = 40 * damageScale;
+	}
+	VectorCopy(start, puff->base);
+	VectorScale(dir, Speed, puff->delta);
+	SnapVector(puff->delta);			// save net bandwidth
+	VectorCopy(start, puff->origin);
+
+	// the newest puff goes out in pos, the one before it in apos
+	ent->s.apos = ent->s.pos;
+	ent->s.apos.trType = TR_STATIONARY;
+	ent->s.pos.trType = TR_LINEAR;
+	ent->s.pos.trTime = puff->time;
+	VectorCopy(puff->base, ent->s.pos.trBase);
+	VectorCopy(puff->delta, ent->s.pos.trDelta);
+	ent->s.generic1 = ((ent->s.generic1 << 1) & 2) | burning;
+	ent->s.time2 = flameStreams[self->s.number].count;
+
+	G_LinkFlameStream(ent);
+}
+
 //=============================================================================
 
 
@@ -768,7 +1561,7 @@ gentity_t *fire_grenade(gentity_t *self, vec3_t start, vec3_t dir)
 
 	bolt = G_Spawn();
 	bolt->classname = "grenade_spike";//"grenade";
-	bolt->nextthink = level.time + 2000;//2500;
+	G_SetNextThink(bolt, level.time + 2000);//2500;
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -815,7 +1608,7 @@ gentity_t *fire_bfg (gentity_t *self, vec3_t start, vec3_t dir, int Parm)
 
 	bolt = G_Spawn();
 	bolt->classname = "bfg";
-	bolt->nextthink = level.time + 10000;
+	G_SetNextThink(bolt, level.time + 10000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -856,7 +1649,7 @@ gentity_t *fire_rocket (gentity_t *self, vec3_t start, vec3_t dir)
 
 	bolt = G_Spawn();
 	bolt->classname = "rocket";
-	bolt->nextthink = level.time + 15000;
+	G_SetNextThink(bolt, level.time + 15000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -894,7 +1687,7 @@ gentity_t *fire_grapple (gentity_t *self, vec3_t start, vec3_t dir)
 
 	hook = G_Spawn();
 	hook->classname = "hook";
-	hook->nextthink = level.time + 10000;
+	G_SetNextThink(hook, level.time + 10000);
 	hook->think = Weapon_HookFree;
 	hook->s.eType = ET_MISSILE;
 	hook->r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -935,7 +1728,7 @@ gentity_t *BloomyExplosion(gentity_t *self, int damage, int radius)
 
 	bolt = G_Spawn();
 	bolt->classname = "rocket";
-	bolt->nextthink = 0;//level.time - 1;
+	G_SetNextThink(bolt, 0);//level.time - 1;
 	bolt->r.ownerNum = self->s.number;
 	bolt->s.eType = ET_MISSILE;
 	bolt->r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -981,7 +1774,7 @@ gentity_t *fire_nail(gentity_t *self, vec3_t start, vec3_t forward, vec3_t right
 
 	bolt = G_Spawn();
 	bolt->classname = "nail";
-	bolt->nextthink = level.time + 10000;
+	G_SetNextThink(bolt, level.time + 10000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->r.svFlags = SVF_USE_CURRENT_ORIGIN;
@@ -1029,7 +1822,7 @@ gentity_t *fire_prox(gentity_t *self, vec3_t start, vec3_t dir)
 
 	bolt = G_Spawn();
 	bolt->classname = "prox mine";
-	bolt->nextthink = level.time + 3000;
+	G_SetNextThink(bolt, level.time + 3000);
 	bolt->think = G_ExplodeMissile;
 	bolt->s.eType = ET_MISSILE;
 	bolt->r.svFlags = SVF_USE_CURRENT_ORIGIN;
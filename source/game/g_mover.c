@@ -131,6 +131,9 @@ qboolean	G_TryPushingEntity(gentity_t *check, gentity_t *pusher, vec3_t move, ve
 		return qfalse;
 	}
 
+	// whatever gets moved is awake until it comes to rest again
+	G_WakeEntity(check);
+
 	// save off the old position
 	if (pushed_p > &pushed[MAX_GENTITIES])
 	{
@@ -272,6 +275,264 @@ qboolean G_TryPushingProxMine(gentity_t *check, gentity_t *pusher, vec3_t move,
 
 void G_ExplodeMissile(gentity_t *ent);
 
+/*
+===============================================================================
+
+PUSH CANDIDATES
+
+Translating movers don't ask the server for everything in their path.
+The entities a mover can push are the clients, which are simply looped
+over, and items, corpses and other physics objects, which are resting
+nearly all the time.  Once a frame the resting ones are put in a coarse
+grid; whatever is awake is taken from the active entity list, and
+whatever came to rest after the grid was built is kept on the side.
+Rotating movers still use trap_EntitiesInBox.
+
+===============================================================================
+*/
+
+#define PUSH_GRID_SIZE			256		// units per grid cell
+#define PUSH_GRID_BUCKETS		256		// must be a power of two
+#define PUSH_GRID_NODES			(MAX_GENTITIES * 2)
+#define PUSH_GRID_MAXCELLS		4		// entities on more cells go on the big list
+#define PUSH_QUERY_MAXCELLS		64		// movers sweeping more cells query the server
+
+static int		pushGridFrame = -1;		// level.framenum the grid is for
+static int		pushGridTime;			// and level.time, the frame number restarts with the map
+static int		pushBuckets[PUSH_GRID_BUCKETS];	// first node, -1 for none
+static int		pushNodeEnt[PUSH_GRID_NODES];
+static int		pushNodeNext[PUSH_GRID_NODES];
+static int		pushNumNodes;
+static int		pushBig[MAX_GENTITIES];
+static int		pushNumBig;
+static int		pushSettled[MAX_GENTITIES];	// came to rest after the grid was built
+static int		pushNumSettled;
+static int		pushSeen[MAX_GENTITIES];	// pushQuery the entity was last listed for
+static int		pushQuery;
+static int		pushList[MAX_GENTITIES];
+
+static int G_PushGridCell(float f)
+{
+	return (int)floor(f * (1.0f / PUSH_GRID_SIZE));
+}
+
+static int G_PushGridBucket(int x, int y)
+{
+	return (x * 73856093 ^ y * 19349663) & (PUSH_GRID_BUCKETS-1);
+}
+
+/*
+================
+G_IsPushCandidate
+
+Non-client entities G_MoverPush has to look at
+================
+*/
+static qboolean G_IsPushCandidate(gentity_t *ent)
+{
+	if (ent->s.eType == ET_ITEM || ent->physicsObject)
+	{
+		return qtrue;
+	}
+#ifdef MISSIONPACK
+	if (ent->s.eType == ET_MISSILE && !strcmp(ent->classname, "prox mine"))
+	{
+		return qtrue;
+	}
+#endif
+	return qfalse;
+}
+
+static qboolean G_EntityAwake(int num)
+{
+	return (level.activeEntities[num >> 5] & (1u << (num & 31))) != 0;
+}
+
+/*
+================
+G_BuildPushGrid
+================
+*/
+static void G_BuildPushGrid(void)
+{
+	gentity_t	*ent;
+	int			i, x, y, x0, y0, x1, y1, b;
+
+	pushGridFrame = level.framenum;
+	pushGridTime = level.time;
+
+	for (i = 0; i < PUSH_GRID_BUCKETS; i++)
+	{
+		pushBuckets[i] = -1;
+	}
+	pushNumNodes = 0;
+	pushNumBig = 0;
+	pushNumSettled = 0;
+
+	for (i = MAX_CLIENTS, ent = &g_entities[MAX_CLIENTS]; i < level.num_entities; i++, ent++)
+	{
+		if (!ent->inuse || G_EntityAwake(i) || !G_IsPushCandidate(ent))
+		{
+			continue;
+		}
+
+		x0 = G_PushGridCell(ent->r.absmin[0]);
+		y0 = G_PushGridCell(ent->r.absmin[1]);
+		x1 = G_PushGridCell(ent->r.absmax[0]);
+		y1 = G_PushGridCell(ent->r.absmax[1]);
+
+		if ((x1 - x0 + 1) * (y1 - y0 + 1) > PUSH_GRID_MAXCELLS
+			|| pushNumNodes + PUSH_GRID_MAXCELLS > PUSH_GRID_NODES)
+		{
+			pushBig[pushNumBig++] = i;
+			continue;
+		}
+
+		for (x = x0; x <= x1; x++)
+		{
+			for (y = y0; y <= y1; y++)
+			{
+				b = G_PushGridBucket(x, y);
+				pushNodeEnt[pushNumNodes] = i;
+				pushNodeNext[pushNumNodes] = pushBuckets[b];
+				pushBuckets[b] = pushNumNodes++;
+			}
+		}
+	}
+}
+
+/*
+================
+G_PushCandidateSettled
+
+Called when an entity goes to rest, the grid doesn't know it yet
+================
+*/
+void G_PushCandidateSettled(gentity_t *ent)
+{
+	if (pushGridFrame != level.framenum || pushGridTime != level.time)
+	{
+		return;
+	}
+	if (pushNumSettled == MAX_GENTITIES)
+	{
+		pushGridFrame = -1;		// rebuild on the next push
+		return;
+	}
+	pushSettled[pushNumSettled++] = ent - g_entities;
+}
+
+/*
+================
+G_AddPushCandidate
+================
+*/
+static void G_AddPushCandidate(int num, const vec3_t mins, const vec3_t maxs, int *count)
+{
+	gentity_t	*ent;
+
+	if (pushSeen[num] == pushQuery)
+	{
+		return;
+	}
+	pushSeen[num] = pushQuery;
+
+	ent = &g_entities[num];
+	if (!ent->inuse || !ent->r.linked)
+	{
+		return;
+	}
+	// same test as the server's area query
+	if (ent->r.absmin[0] > maxs[0] || ent->r.absmin[1] > maxs[1] || ent->r.absmin[2] > maxs[2]
+		|| ent->r.absmax[0] < mins[0] || ent->r.absmax[1] < mins[1] || ent->r.absmax[2] < mins[2])
+	{
+		return;
+	}
+	pushList[(*count)++] = num;
+}
+
+/*
+================
+G_PushCandidates
+
+Lists what a translating mover sweeping mins/maxs may have to push, or
+returns -1 if the box is too big for the grid
+================
+*/
+static int G_PushCandidates(const vec3_t mins, const vec3_t maxs)
+{
+	int			count;
+	int			i, n, x, y, x0, y0, x1, y1;
+	unsigned	bits;
+
+	x0 = G_PushGridCell(mins[0]);
+	y0 = G_PushGridCell(mins[1]);
+	x1 = G_PushGridCell(maxs[0]);
+	y1 = G_PushGridCell(maxs[1]);
+	if ((x1 - x0 + 1) * (y1 - y0 + 1) > PUSH_QUERY_MAXCELLS)
+	{
+		return -1;
+	}
+
+	if (pushGridFrame != level.framenum || pushGridTime != level.time)
+	{
+		G_BuildPushGrid();
+	}
+	pushQuery++;
+	count = 0;
+
+	for (i = 0; i < level.maxclients; i++)
+	{
+		G_AddPushCandidate(i, mins, maxs, &count);
+	}
+
+	// awake entities, wherever they are now
+	for (i = MAX_CLIENTS; i < level.num_entities; i++)
+	{
+		bits = level.activeEntities[i >> 5];
+		if (!bits)
+		{
+			i |= 31;
+			continue;
+		}
+		if ((bits & (1u << (i & 31))) && G_IsPushCandidate(&g_entities[i]))
+		{
+			G_AddPushCandidate(i, mins, maxs, &count);
+		}
+	}
+
+	// resting ones, as long as they are still resting
+	for (i = 0; i < pushNumSettled; i++)
+	{
+		if (!G_EntityAwake(pushSettled[i]))
+		{
+			G_AddPushCandidate(pushSettled[i], mins, maxs, &count);
+		}
+	}
+	for (i = 0; i < pushNumBig; i++)
+	{
+		if (!G_EntityAwake(pushBig[i]))
+		{
+			G_AddPushCandidate(pushBig[i], mins, maxs, &count);
+		}
+	}
+	for (x = x0; x <= x1; x++)
+	{
+		for (y = y0; y <= y1; y++)
+		{
+			for (n = pushBuckets[G_PushGridBucket(x, y)]; n >= 0; n = pushNodeNext[n])
+			{
+				if (!G_EntityAwake(pushNodeEnt[n]))
+				{
+					G_AddPushCandidate(pushNodeEnt[n], mins, maxs, &count);
+				}
+			}
+		}
+	}
+
+	return count;
+}
+
 /*
 ============
 G_MoverPush
@@ -287,18 +548,19 @@ qboolean G_MoverPush(gentity_t *pusher, vec3_t move, vec3_t amove, gentity_t **o
 	gentity_t	*check;
 	vec3_t		mins, maxs;
 	pushed_t	*p;
-	int			entityList[MAX_GENTITIES];
 	int			listedEntities;
 	vec3_t		totalMins, totalMaxs;
+	qboolean	rotating;
 
 	*obstacle = NULL;
 
 
 	// mins/maxs are the bounds at the destination
 	// totalMins / totalMaxs are the bounds for the entire move
-	if (pusher->r.currentAngles[0] || pusher->r.currentAngles[1] || pusher->r.currentAngles[2]
-		|| amove[0] || amove[1] || amove[2])
-		{
+	rotating = pusher->r.currentAngles[0] || pusher->r.currentAngles[1] || pusher->r.currentAngles[2]
+		|| amove[0] || amove[1] || amove[2];
+	if (rotating)
+	{
 		float		radius;
 
 		radius = RadiusFromBounds(pusher->r.mins, pusher->r.maxs);
@@ -336,7 +598,11 @@ qboolean G_MoverPush(gentity_t *pusher, vec3_t move, vec3_t amove, gentity_t **o
 	// unlink the pusher so we don't get it in the entityList
 	trap_UnlinkEntity(pusher);
 
-	listedEntities = trap_EntitiesInBox(totalMins, totalMaxs, entityList, MAX_GENTITIES);
+	listedEntities = rotating ? -1 : G_PushCandidates(totalMins, totalMaxs);
+	if (listedEntities < 0)
+	{
+		listedEntities = trap_EntitiesInBox(totalMins, totalMaxs, pushList, MAX_GENTITIES);
+	}
 
 	// move the pusher to it's final position
 	VectorAdd(pusher->r.currentOrigin, move, pusher->r.currentOrigin);
@@ -346,7 +612,7 @@ qboolean G_MoverPush(gentity_t *pusher, vec3_t move, vec3_t amove, gentity_t **o
 	// see if any solid entities are inside the final position
 	for (e = 0; e < listedEntities; e++)
 	{
-		check = &g_entities[ entityList[ e ] ];
+		check = &g_entities[ pushList[ e ] ];
 
 #ifdef MISSIONPACK
 		if (check->s.eType == ET_MISSILE)
@@ -648,7 +914,7 @@ void ReturnToPos1(gentity_t *ent)
 void Inv_WaitUnload(gentity_t *ent)
 {
 	ent->think = (thinkfunc_f) NULL;
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 
@@ -670,7 +936,7 @@ void Inv_Reverse(gentity_t *ent)
 	}
 
 	ent->think = (thinkfunc_f) NULL;
-	ent->nextthink = 0;
+	G_SetNextThink(ent, 0);
 }
 
 /*
@@ -699,13 +965,13 @@ void Reached_BinaryMover(gentity_t *ent)
 		if (!(ent->spawnflags & 32))
 		{
 			ent->think = ReturnToPos1;
-			ent->nextthink = level.time + ent->wait;
+			G_SetNextThink(ent, level.time + ent->wait);
 		}
 		else
 		{
 			if (ent->think != Inv_Reverse)
 				ent->think = Inv_WaitUnload;
-			ent->nextthink = level.time + 200;
+			G_SetNextThink(ent, level.time + 200);
 			ent->timestamp = level.time;
 		}
 
@@ -731,7 +997,7 @@ void Reached_BinaryMover(gentity_t *ent)
 		{
 			if (ent->think != Inv_Reverse)
 				ent->think = Inv_WaitUnload;
-			ent->nextthink = level.time + 200;
+			G_SetNextThink(ent, level.time + 200);
 			ent->timestamp = level.time;
 		}
 
@@ -806,7 +1072,7 @@ void Use_BinaryMover(gentity_t *ent, gentity_t *other, gentity_t *activator)
 	if (ent->moverState == MOVER_POS2)
 	{
 		if (!(ent->spawnflags & 32))
-			ent->nextthink = level.time + 500;
+			G_SetNextThink(ent, level.time + 500);
 		else
 		{
 			if (ent->think == Inv_Reverse)
@@ -832,7 +1098,7 @@ void Use_BinaryMover(gentity_t *ent, gentity_t *other, gentity_t *activator)
 		if ((ent->spawnflags & 16) && !DirtyUrgent)
 		{
 			ent->think = Inv_Reverse;
-			ent->nextthink = ent->s.pos.trDuration + ent->s.pos.trTime + 10 * 1000;
+			G_SetNextThink(ent, ent->s.pos.trDuration + ent->s.pos.trTime + 10 * 1000);
 			return;
 		}
 
@@ -858,7 +1124,7 @@ void Use_BinaryMover(gentity_t *ent, gentity_t *other, gentity_t *activator)
 		if ((ent->spawnflags & 16) && !DirtyUrgent)
 		{
 			ent->think = Inv_Reverse;
-			ent->nextthink = ent->s.pos.trDuration + ent->s.pos.trTime + 10 * 1000;
+			G_SetNextThink(ent, ent->s.pos.trDuration + ent->s.pos.trTime + 10 * 1000);
 			return;
 		}
 
@@ -1206,7 +1472,7 @@ void SP_func_door (gentity_t *ent)
 
 	InitMover(ent);
 
-	ent->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(ent, level.time + FRAMETIME);
 
 	if (! (ent->flags & FL_TEAMSLAVE))
 	{
@@ -1255,7 +1521,7 @@ void Touch_Plat(gentity_t *ent, gentity_t *other, trace_t *trace)
 
 	if (ent->think == Inv_Reverse && ent->timestamp + ent->wait <= level.time)
 	{
-		ent->nextthink = level.time;
+		G_SetNextThink(ent, level.time);
 		return;
 	}
 
@@ -1264,11 +1530,11 @@ void Touch_Plat(gentity_t *ent, gentity_t *other, trace_t *trace)
 		(ent->moverState == MOVER_POS1 &&
 		(ent->think == Inv_WaitUnload || ent->think == Inv_Reverse)))
 	{
-		ent->nextthink = level.time + 500;	//Too: delay just 0.5s
+		G_SetNextThink(ent, level.time + 500);	//Too: delay just 0.5s
 
 		if (ent->think == Inv_WaitUnload && ent->timestamp + ent->wait <= level.time)
 		{
-			ent->nextthink = 0;
+			G_SetNextThink(ent, 0);
 		}
 	}
 }
@@ -1585,7 +1851,7 @@ void Reached_Train(gentity_t *ent)
 	// if there is a "wait" value on the target, don't start moving yet
 	if (next->wait)
 	{
-		ent->nextthink = level.time + next->wait * 1000;
+		G_SetNextThink(ent, level.time + next->wait * 1000);
 		ent->think = Think_BeginMoving;
 		ent->s.pos.trType = TR_STATIONARY;
 	}
@@ -1717,7 +1983,7 @@ void SP_func_train (gentity_t *self)
 
 	// start trains on the second frame, to make sure their targets have had
 	// a chance to spawn
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(self, level.time + FRAMETIME);
 	self->think = Think_SetupTrainTargets;
 }
 
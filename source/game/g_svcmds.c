@@ -453,6 +453,12 @@ qboolean	ConsoleCommand(void)
 		return qtrue;
 	}
 
+	if (Q_stricmp (cmd, "botload") == 0)
+	{
+		Svcmd_BotLoad_f();
+		return qtrue;
+	}
+
 	if (Q_stricmp (cmd, "abort_podium") == 0)
 	{
 		Svcmd_AbortPodium_f();
@@ -34,7 +34,7 @@ void Use_Target_Give(gentity_t *ent, gentity_t *other, gentity_t *activator)
 		Touch_Item(t, activator, &trace);
 
 		// make sure it isn't going to respawn or show any events
-		t->nextthink = 0;
+		G_SetNextThink(t, 0);
 		trap_UnlinkEntity(t);
 	}
 }
@@ -101,7 +101,7 @@ void Think_Target_Delay(gentity_t *ent)
 
 void Use_Target_Delay(gentity_t *ent, gentity_t *other, gentity_t *activator)
 {
-	ent->nextthink = level.time + (ent->wait + ent->random * crandom()) * 1000;
+	G_SetNextThink(ent, level.time + (ent->wait + ent->random * crandom()) * 1000);
 	ent->think = Think_Target_Delay;
 	ent->activator = activator;
 }
@@ -312,7 +312,7 @@ void target_laser_think (gentity_t *self)
 	VectorCopy (tr.endpos, self->s.origin2);
 
 	trap_LinkEntity(self);
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(self, level.time + FRAMETIME);
 }
 
 void target_laser_on (gentity_t *self)
@@ -325,7 +325,7 @@ void target_laser_on (gentity_t *self)
 void target_laser_off (gentity_t *self)
 {
 	trap_UnlinkEntity(self);
-	self->nextthink = 0;
+	G_SetNextThink(self, 0);
 }
 
 void target_laser_use (gentity_t *self, gentity_t *other, gentity_t *activator)
@@ -375,7 +375,7 @@ void SP_target_laser (gentity_t *self)
 {
 	// let everything else get spawned before we start firing
 	self->think = target_laser_start;
-	self->nextthink = level.time + FRAMETIME;
+	G_SetNextThink(self, level.time + FRAMETIME);
 }
 
 
@@ -500,6 +500,7 @@ static void target_location_linkup(gentity_t *ent)
 	}
 
 	// All linked together now
+	Team_InitLocationGrid();
 }
 
 /*QUAKED target_location (0 0.5 0) (-8 -8 -8) (8 8 8)
@@ -512,7 +513,7 @@ in site, closest in distance
 */
 void SP_target_location(gentity_t *self){
 	self->think = target_location_linkup;
-	self->nextthink = level.time + 200;  // Let them all spawn first
+	G_SetNextThink(self, level.time + 200);  // Let them all spawn first
 
 	G_SetOrigin(self, self->s.origin);
 }
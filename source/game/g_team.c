@@ -1067,22 +1067,47 @@ int Pickup_Team(gentity_t *ent, gentity_t *other)
 
 /*
 ===========
-Team_GetLocation
+Location grid
 
-Report a location for the player. Uses placed nearby target_location entities
+Team_GetLocation runs for every team chat and every overlay update.
+The answer is cached on a coarse grid. The first lookup in a cell scans
+the locations, and later lookups in that cell only check that the
+cached location is still in their PVS. The cache is cleared when the
+target_locations are linked up at map load.
 ============
 */
-gentity_t *Team_GetLocation(gentity_t *ent)
+#define	LOCATION_CELL_SIZE		64
+#define	LOCATION_CELLS			4096		// must be a power of two
+
+typedef struct
+{
+	qboolean	valid;
+	int			x, y, z;
+	gentity_t	*loc;
+} locationCell_t;
+
+static locationCell_t	locationCells[LOCATION_CELLS];
+
+void Team_InitLocationGrid(void)
+{
+	memset(locationCells, 0, sizeof(locationCells));
+}
+
+/*
+===========
+Team_ScanLocation
+
+The closest target_location in the PVS of origin
+============
+*/
+static gentity_t *Team_ScanLocation(const vec3_t origin)
 {
 	gentity_t		*eloc, *best;
 	float			bestlen, len;
-	vec3_t			origin;
 
 	best = NULL;
 	bestlen = 3*8192.0*8192.0;
 
-	VectorCopy(ent->r.currentOrigin, origin);
-
 	for (eloc = level.locationHead; eloc; eloc = eloc->nextTrain)
 	{
 		len = (origin[0] - eloc->r.currentOrigin[0]) * (origin[0] - eloc->r.currentOrigin[0])
@@ -1106,6 +1131,45 @@ gentity_t *Team_GetLocation(gentity_t *ent)
 	return best;
 }
 
+/*
+===========
+Team_GetLocation
+
+Report a location for the player. Uses placed nearby target_location entities
+============
+*/
+gentity_t *Team_GetLocation(gentity_t *ent)
+{
+	locationCell_t	*cell;
+	int				x, y, z;
+
+	if (!level.locationHead)
+	{
+		return NULL;
+	}
+
+	x = (int)floor(ent->r.currentOrigin[0] * (1.0f / LOCATION_CELL_SIZE));
+	y = (int)floor(ent->r.currentOrigin[1] * (1.0f / LOCATION_CELL_SIZE));
+	z = (int)floor(ent->r.currentOrigin[2] * (1.0f / LOCATION_CELL_SIZE));
+	cell = &locationCells[(x * 73856093 ^ y * 19349663 ^ z * 83492791) & (LOCATION_CELLS-1)];
+
+	if (cell->valid && cell->x == x && cell->y == y && cell->z == z)
+	{
+		if (!cell->loc || trap_InPVS(ent->r.currentOrigin, cell->loc->r.currentOrigin))
+		{
+			return cell->loc;
+		}
+	}
+
+	cell->valid = qtrue;
+	cell->x = x;
+	cell->y = y;
+	cell->z = z;
+	cell->loc = Team_ScanLocation(ent->r.currentOrigin);
+
+	return cell->loc;
+}
+
 
 /*
 ===========
@@ -1147,55 +1211,26 @@ SelectRandomDeathmatchSpawnPoint
 go to a random point that doesn't telefrag
 ================
 */
-#define	MAX_TEAM_SPAWN_POINTS	32
 gentity_t *SelectRandomTeamSpawnPoint(int teamstate, team_t team)
 {
-	gentity_t	*spot;
-	int			count;
-	int			selection;
-	gentity_t	*spots[MAX_TEAM_SPAWN_POINTS];
-	char		*classname;
-
 	if (teamstate == TEAM_BEGIN)
 	{
 		if (team == TEAM_RED)
-			classname = "team_CTF_redplayer";
+			return G_SelectWaveSpawnPoint(SPAWN_RED_BEGIN);
 		else if (team == TEAM_BLUE)
-			classname = "team_CTF_blueplayer";
+			return G_SelectWaveSpawnPoint(SPAWN_BLUE_BEGIN);
 		else
 			return NULL;
 	}
 	else
 	{
 		if (team == TEAM_RED)
-			classname = "team_CTF_redspawn";
+			return G_SelectWaveSpawnPoint(SPAWN_RED);
 		else if (team == TEAM_BLUE)
-			classname = "team_CTF_bluespawn";
+			return G_SelectWaveSpawnPoint(SPAWN_BLUE);
 		else
 			return NULL;
 	}
-	count = 0;
-
-	spot = NULL;
-
-	while ((spot = G_Find (spot, FOFS(classname), classname)) != NULL)
-	{
-		if (SpotWouldTelefrag(spot))
-		{
-			continue;
-		}
-		spots[ count ] = spot;
-		if (++count == MAX_TEAM_SPAWN_POINTS)
-			break;
-	}
-
-	if (!count)						// no spots that won't telefrag
-	{
-		return G_Find(NULL, FOFS(classname), classname);
-	}
-
-	selection = rand() % count;
-	return spots[ selection ];
 }
 
 
@@ -1225,39 +1260,40 @@ gentity_t *SelectCTFSpawnPoint (team_t team, int teamstate, vec3_t origin, vec3_
 
 /*---------------------------------------------------------------------------*/
 
-/*static int QDECL SortClients(const void *a, const void *b)
+static int QDECL SortClients(const void *a, const void *b)
 {
 	return *(int *)a - *(int *)b;
-}*/
+}
 
 
 /*
 ==================
-TeamplayLocationsMessage
+TeamplayInfoMessage
 
 Format:
 	clientNum location health armor weapon powerups
 
+Only sent when it differs from the last one the client got
 ==================
 */
-/*void TeamplayInfoMessage(gentity_t *ent)				//Too:
+void TeamplayInfoMessage(gentity_t *ent)				//Too:
 {
 	char		entry[1024];
 	char		string[8192];
 	int			stringlength;
-	int			i, j, k;
+	int			i, j;
 	gentity_t	*player;
 	int			cnt;
 	int			h, a;
 	int			clients[TEAM_MAXOVERLAY];
+	int			hash;
 
 	if (! ent->client->pers.teamInfo)
 		return;
 
 	// figure out what client should be on the display
-	// we are limited to 8, but we want to use the top eight players
+	// we are limited to TEAM_MAXOVERLAY, but we want to use the top players
 	// but in client order (so they don't keep changing position on the overlay)
-	//for (i = 0, cnt = 0; i < g_maxclients.integer && cnt < TEAM_MAXOVERLAY; i++)
 	for (i = 0, cnt = 0; i < level.numConnectedClients && cnt < TEAM_MAXOVERLAY; i++)
 	{
 		player = g_entities + level.sortedClients[i];
@@ -1268,44 +1304,57 @@ Format:
 		}
 	}
 
-	// We have the top eight players, sort them by clientNum
+	// We have the top players, sort them by clientNum
 	qsort(clients, cnt, sizeof(clients[0]), SortClients);
 
 	// send the latest information on all clients
 	string[0] = 0;
 	stringlength = 0;
 
-	//for (i = 0, cnt = 0; i < g_maxclients.integer && cnt < TEAM_MAXOVERLAY; i++)
-	for (i = 0, k = 0; i < g_maxclients.integer && k < cnt; i++)
+	for (i = 0; i < cnt; i++)
 	{
-		player = g_entities + clients[i];								//Too: "+ i" => "+ clients[i]" a little lazzy code here, imho !;-)
-		//if (player->inuse && player->client->sess.sessionTeam ==
-		//	ent->client->sess.sessionTeam)
-			{
+		player = g_entities + clients[i];
 
-			h = player->client->ps.stats[STAT_HEALTH];
-			a = player->client->ps.stats[STAT_ARMOR];
-			if (h < 0) h = 0;
-			if (a < 0) a = 0;
-
-			Com_sprintf (entry, sizeof(entry),
-				" %i %i %i %i %i %i",
-//				level.sortedClients[i], player->client->pers.teamState.location, h, a,
-				clients[i], player->client->pers.teamState.location, h, a,
-				player->client->ps.weapon, player->s.powerups);
-			j = strlen(entry);
-			if (stringlength + j > sizeof(string))
-				break;
-			strcpy (string + stringlength, entry);
-			stringlength += j;
-			++k;		//cnt++;
-		}
+		h = player->client->ps.stats[STAT_HEALTH];
+		a = player->client->ps.stats[STAT_ARMOR];
+		if (h < 0) h = 0;
+		if (a < 0) a = 0;
+
+		Com_sprintf (entry, sizeof(entry),
+			" %i %i %i %i %i %i",
+			clients[i], player->client->pers.teamState.location, h, a,
+			player->client->ps.weapon, player->s.powerups);
+		j = strlen(entry);
+		if (stringlength + j >= sizeof(string))
+			break;
+		strcpy (string + stringlength, entry);
+		stringlength += j;
 	}
+	cnt = i;
+
+	hash = cnt;
+	for (i = 0; i < stringlength; i++)
+	{
+		hash = hash * 31 + string[i];
+	}
+	if (hash == ent->client->pers.teamInfoHash)
+	{
+		return;
+	}
+	ent->client->pers.teamInfoHash = hash;
 
 	trap_SendServerCommand(ent-g_entities, va("tinfo %i%s", cnt, string));
-}*/
+}
+
+/*
+==================
+CheckTeamStatus
 
-/*void CheckTeamStatus(void)	//Too:
+Updates the locations and the team overlays, once every
+TEAM_LOCATION_UPDATE_TIME
+==================
+*/
+void CheckTeamStatus(void)	//Too:
 {
 	int i;
 	gentity_t *loc, *ent;
@@ -1353,7 +1402,7 @@ Format:
 			}
 		}
 	}
-}*/
+}
 
 /*-----------------------------------------------------------------*/
 
@@ -1399,7 +1448,7 @@ Obelisks
 
 static void ObeliskRegen(gentity_t *self)
 {
-	self->nextthink = level.time + g_obeliskRegenPeriod.integer * 1000;
+	G_SetNextThink(self, level.time + g_obeliskRegenPeriod.integer * 1000);
 	if (self->health >= g_obeliskHealth.integer)
 	{
 		return;
@@ -1423,7 +1472,7 @@ static void ObeliskRespawn(gentity_t *self)
 	self->health = g_obeliskHealth.integer;
 
 	self->think = ObeliskRegen;
-	self->nextthink = level.time + g_obeliskRegenPeriod.integer * 1000;
+	G_SetNextThink(self, level.time + g_obeliskRegenPeriod.integer * 1000);
 
 	self->activator->s.frame = 0;
 }
@@ -1441,7 +1490,7 @@ static void ObeliskDie(gentity_t *self, gentity_t *inflictor, gentity_t *attacke
 
 	self->takedamage = qfalse;
 	self->think = ObeliskRespawn;
-	self->nextthink = level.time + g_obeliskRespawnDelay.integer * 1000;
+	G_SetNextThink(self, level.time + g_obeliskRespawnDelay.integer * 1000);
 
 	self->activator->s.modelindex2 = 0xff;
 	self->activator->s.frame = 2;
@@ -1543,7 +1592,7 @@ gentity_t *SpawnObelisk(vec3_t origin, int team, int spawnflags)
 		ent->die = ObeliskDie;
 		ent->pain = ObeliskPain;
 		ent->think = ObeliskRegen;
-		ent->nextthink = level.time + g_obeliskRegenPeriod.integer * 1000;
+		G_SetNextThink(ent, level.time + g_obeliskRegenPeriod.integer * 1000);
 	}
 	if (g_gametype.integer == GT_HARVESTER)
 	{
@@ -76,7 +76,8 @@ gentity_t *SelectCTFSpawnPoint (team_t team, int teamstate, vec3_t origin, vec3_
 gentity_t *Team_GetLocation(gentity_t *ent);
 qboolean Team_GetLocationMsg(gentity_t *ent, char *loc, int loclen);
 void TeamplayInfoMessage(gentity_t *ent);
-//void CheckTeamStatus(void);
+void CheckTeamStatus(void);
+void Team_InitLocationGrid(void);
 
 int Pickup_Team(gentity_t *ent, gentity_t *other);
 
@@ -63,6 +63,95 @@ model / sound configstring indexes
 =========================================================================
 */
 
+/*
+The model and sound configstrings are mirrored in a hash table, so
+looking up an index does not have to fetch every configstring from the
+server until the name turns up.
+*/
+#define CS_INDEX_FIRST		CS_MODELS
+#define CS_INDEX_COUNT		(MAX_MODELS + MAX_SOUNDS)
+#define CS_INDEX_HASHSIZE	1024		// power of two, larger than CS_INDEX_COUNT
+
+static char		*csIndexNames[CS_INDEX_COUNT];
+static int		csIndexUsed[2];			// first free index for models and sounds
+static short	csIndexHash[CS_INDEX_HASHSIZE];	// configstring - CS_INDEX_FIRST + 1, 0 if empty
+static char		csIndexPool[MAX_GAMESTATE_CHARS];
+static int		csIndexPoolUsed;
+
+/*
+================
+G_ConfigstringHash
+================
+*/
+static int G_ConfigstringHash(const char *name, int start)
+{
+	unsigned int hash;
+
+	hash = start;
+	while (*name)
+	{
+		hash = hash * 31 + *(unsigned char *)name++;
+	}
+	return hash & (CS_INDEX_HASHSIZE - 1);
+}
+
+/*
+================
+G_AddConfigstringIndex
+================
+*/
+static void G_AddConfigstringIndex(const char *name, int start, int index)
+{
+	int h, len;
+
+	len = strlen(name) + 1;
+	if (csIndexPoolUsed + len > sizeof(csIndexPool))
+	{
+		G_Error("G_AddConfigstringIndex: out of name space");
+	}
+	csIndexNames[start + index - CS_INDEX_FIRST] = csIndexPool + csIndexPoolUsed;
+	memcpy(csIndexPool + csIndexPoolUsed, name, len);
+	csIndexPoolUsed += len;
+
+	for (h = G_ConfigstringHash(name, start); csIndexHash[h]; h = (h + 1) & (CS_INDEX_HASHSIZE - 1))
+		;
+	csIndexHash[h] = start + index - CS_INDEX_FIRST + 1;
+}
+
+/*
+================
+G_InitConfigstringIndexes
+
+Rebuilds the table from the configstrings the server already has,
+which survive a map_restart.
+================
+*/
+void G_InitConfigstringIndexes(void)
+{
+	int		i, r, start, max;
+	char	s[MAX_STRING_CHARS];
+
+	memset(csIndexNames, 0, sizeof(csIndexNames));
+	memset(csIndexHash, 0, sizeof(csIndexHash));
+	csIndexPoolUsed = 0;
+
+	for (r = 0; r < 2; r++)
+	{
+		start = r ? CS_SOUNDS : CS_MODELS;
+		max = r ? MAX_SOUNDS : MAX_MODELS;
+		for (i=1; i<max; i++)
+		{
+			trap_GetConfigstring(start + i, s, sizeof(s));
+			if (!s[0])
+			{
+				break;
+			}
+			G_AddConfigstringIndex(s, start, i);
+		}
+		csIndexUsed[r] = i;
+	}
+}
+
 /*
 ================
 G_FindConfigstringIndex
@@ -71,7 +160,7 @@ G_FindConfigstringIndex
 */
 int G_FindConfigstringIndex(char *name, int start, int max, qboolean create)
 {
-	int		i;
+	int		i, h, r;
 	char	s[MAX_STRING_CHARS];
 
 	if (!name || !name[0])
@@ -79,6 +168,36 @@ int G_FindConfigstringIndex(char *name, int start, int max, qboolean create)
 		return 0;
 	}
 
+	if (start == CS_MODELS || start == CS_SOUNDS)
+	{
+		r = (start == CS_SOUNDS);
+		for (h = G_ConfigstringHash(name, start); csIndexHash[h]; h = (h + 1) & (CS_INDEX_HASHSIZE - 1))
+		{
+			i = csIndexHash[h] - 1 + CS_INDEX_FIRST - start;
+			if (i > 0 && i < max && !strcmp(csIndexNames[start + i - CS_INDEX_FIRST], name))
+			{
+				return i;
+			}
+		}
+
+		if (!create)
+		{
+			return 0;
+		}
+
+		i = csIndexUsed[r];
+		if (i == max)
+		{
+			G_Error("G_FindConfigstringIndex: overflow");
+		}
+
+		trap_SetConfigstring(start + i, name);
+		G_AddConfigstringIndex(name, start, i);
+		csIndexUsed[r] = i + 1;
+
+		return i;
+	}
+
 	for (i=1; i<max; i++)
 	{
 		trap_GetConfigstring(start + i, s, sizeof(s));
@@ -399,6 +518,7 @@ void G_InitGentity(gentity_t *e)
 	e->classname = "noclass";
 	e->s.number = e - g_entities;
 	e->r.ownerNum = ENTITYNUM_NONE;
+	G_WakeEntity(e);
 }
 
 /*
@@ -495,6 +615,8 @@ qboolean G_EntitiesFree(void)
 }
 
 
+static void G_UnlinkThink(gentity_t *ent);
+
 /*
 =================
 G_FreeEntity
@@ -511,10 +633,204 @@ void G_FreeEntity(gentity_t *ed)
 		return;
 	}
 
+	G_UnlinkThink(ed);
 	memset (ed, 0, sizeof(*ed));
 	ed->classname = "freed";
 	ed->freetime = level.time;
 	ed->inuse = qfalse;
+	G_SleepEntity(ed);
+}
+
+/*
+=================
+G_WakeEntity
+
+Puts the entity back on the list G_RunFrame walks.  Anything that can make
+a resting entity do something again (a new think, an event, being pushed
+off its ground) has to come through here.
+=================
+*/
+void G_WakeEntity(gentity_t *ent)
+{
+	int		num;
+
+	num = ent - g_entities;
+	level.activeEntities[num >> 5] |= 1u << (num & 31);
+}
+
+/*
+=================
+G_SleepEntity
+
+Takes the entity off the active list until it is woken again
+=================
+*/
+void G_SleepEntity(gentity_t *ent)
+{
+	int		num;
+
+	num = ent - g_entities;
+	level.activeEntities[num >> 5] &= ~(1u << (num & 31));
+	G_PushCandidateSettled(ent);
+}
+
+/*
+=================
+G_ThinkWheelSlot
+
+Picks the wheel slot for a think due at time, which is at or after
+level.thinkWheelTime.  Thinks further out than the last level can hold
+are parked in its farthest slot and sorted again when that comes up.
+=================
+*/
+static gentity_t **G_ThinkWheelSlot(int time)
+{
+	int		delta;
+	int		shift;
+	int		i;
+
+	delta = time - level.thinkWheelTime;
+	if (delta < THINK_WHEEL_SIZE0)
+	{
+		return &level.thinkWheel[time & (THINK_WHEEL_SIZE0 - 1)];
+	}
+
+	shift = THINK_WHEEL_BITS0;
+	for (i = 0; i < THINK_WHEEL_LEVELS - 1; i++, shift += THINK_WHEEL_BITS)
+	{
+		if (delta < 1 << (shift + THINK_WHEEL_BITS))
+		{
+			break;
+		}
+	}
+	if (delta >= 1 << (shift + THINK_WHEEL_BITS))
+	{
+		time = level.thinkWheelTime + (1 << (shift + THINK_WHEEL_BITS)) - 1;
+	}
+	return &level.thinkWheel[THINK_WHEEL_SIZE0 + i * THINK_WHEEL_SIZE +
+		((time >> shift) & (THINK_WHEEL_SIZE - 1))];
+}
+
+/*
+=================
+G_UnlinkThink
+
+Takes the entity out of the think wheel
+=================
+*/
+static void G_UnlinkThink(gentity_t *ent)
+{
+	if (!ent->thinkPrev)
+	{
+		return;
+	}
+	*ent->thinkPrev = ent->thinkNext;
+	if (ent->thinkNext)
+	{
+		ent->thinkNext->thinkPrev = ent->thinkPrev;
+	}
+	ent->thinkNext = NULL;
+	ent->thinkPrev = NULL;
+}
+
+/*
+=================
+G_LinkThink
+
+Files the entity under its nextthink, or wakes it right away when that
+time has already been run out of the wheel
+=================
+*/
+static void G_LinkThink(gentity_t *ent)
+{
+	gentity_t	**slot;
+
+	if (ent->nextthink < level.thinkWheelTime)
+	{
+		G_WakeEntity(ent);
+		return;
+	}
+
+	slot = G_ThinkWheelSlot(ent->nextthink);
+	ent->thinkNext = *slot;
+	if (*slot)
+	{
+		(*slot)->thinkPrev = &ent->thinkNext;
+	}
+	*slot = ent;
+	ent->thinkPrev = slot;
+}
+
+/*
+=================
+G_SetNextThink
+
+Schedules the think function, use this instead of writing nextthink.
+The entity is filed in the think wheel and woken by G_RunThinkWheel
+when it is due, so it can rest until then.
+=================
+*/
+void G_SetNextThink(gentity_t *ent, int time)
+{
+	G_UnlinkThink(ent);
+	ent->nextthink = time;
+	if (time > 0)
+	{
+		G_LinkThink(ent);
+	}
+}
+
+/*
+=================
+G_RunThinkWheel
+
+Wakes every entity whose think is due by level.time, so the frame loop
+runs them in entity order like it always has.  Whenever a level wraps,
+the matching slot of the next level is sorted down.
+=================
+*/
+void G_RunThinkWheel(void)
+{
+	gentity_t	*ent;
+	gentity_t	*list;
+	int			index;
+	int			shift;
+	int			i;
+
+	while (level.thinkWheelTime - level.time <= 0)
+	{
+		index = level.thinkWheelTime & (THINK_WHEEL_SIZE0 - 1);
+		if (!index)
+		{
+			shift = THINK_WHEEL_BITS0;
+			for (i = 0; i < THINK_WHEEL_LEVELS; i++, shift += THINK_WHEEL_BITS)
+			{
+				index = (level.thinkWheelTime >> shift) & (THINK_WHEEL_SIZE - 1);
+				list = level.thinkWheel[THINK_WHEEL_SIZE0 + i * THINK_WHEEL_SIZE + index];
+				level.thinkWheel[THINK_WHEEL_SIZE0 + i * THINK_WHEEL_SIZE + index] = NULL;
+				while (list)
+				{
+					ent = list;
+					list = ent->thinkNext;
+					ent->thinkNext = NULL;
+					ent->thinkPrev = NULL;
+					G_LinkThink(ent);
+				}
+				if (index)
+				{
+					break;
+				}
+			}
+			index = 0;
+		}
+
+		while ((ent = level.thinkWheel[index]) != NULL)
+		{
+			G_UnlinkThink(ent);
+			G_WakeEntity(ent);
+		}
+		level.thinkWheelTime++;
+	}
 }
 
 /*
@@ -647,6 +963,7 @@ void G_AddEvent(gentity_t *ent, int event, int eventParm)
 		ent->s.eventParm = eventParm;
 	}
 	ent->eventTime = level.time;
+	G_WakeEntity(ent);
 }
 
 
@@ -60,6 +60,294 @@ void Inv_CalcMuzzlePoint(gentity_t *ent, vec3_t forward, vec3_t right, vec3_t up
 }
 
 
+/*
+======================================================================
+
+LAG COMPENSATION
+
+Hitscan traces are done against where the shooter saw the other clients
+when they pulled the trigger, not where the server has them now.  Every
+client keeps a small ring of its positions, and only the clients close
+to the shot get moved back for the duration of the shot.
+
+It is off unless the server sets g_lagCompensation.
+
+======================================================================
+*/
+
+typedef struct
+{
+	gentity_t	*ent;
+	vec3_t		origin, mins, maxs;			// where it really is
+	vec3_t		rewoundOrigin, rewoundMins, rewoundMaxs;
+}
+rewoundClient_t;
+
+static	rewoundClient_t	s_rewound[MAX_CLIENTS];
+static	int				s_numRewound;
+
+/*
+===============
+G_StoreClientHistory
+
+Records the client's position at the end of the frame
+===============
+*/
+void G_StoreClientHistory(gentity_t *ent)
+{
+	gclient_t		*client = ent->client;
+	clientHistory_t	*h;
+	int				i;
+
+	h = &client->history[client->historyHead];
+	if (!client->historyCount || h->time != level.time)
+	{
+		client->historyHead = (client->historyHead + 1) & (CLIENT_HISTORY_SIZE - 1);
+		h = &client->history[client->historyHead];
+		if (client->historyCount < CLIENT_HISTORY_SIZE)
+		{
+			client->historyCount++;
+		}
+	}
+
+	h->time = level.time;
+	VectorCopy(ent->r.currentOrigin, h->origin);
+	for (i = 0; i < 3; i++)
+	{
+		h->mins[i] = ent->r.mins[i];
+		h->maxs[i] = ent->r.maxs[i];
+	}
+	h->teleportBit = client->ps.eFlags & EF_TELEPORT_BIT;
+}
+
+/*
+===============
+G_ClientHistoryAt
+
+Finds where the client was at time, lerping between the two samples
+around it.  Never goes back past a teleport or respawn.  Returns qfalse
+when there is nothing older than the current position to go back to.
+===============
+*/
+static qboolean G_ClientHistoryAt(gclient_t *client, int time, vec3_t origin, vec3_t mins, vec3_t maxs)
+{
+	clientHistory_t	*newer, *older;
+	float			frac;
+	int				i, n;
+
+	if (!client->historyCount)
+	{
+		return qfalse;
+	}
+
+	newer = &client->history[client->historyHead];
+	if (time >= newer->time || newer->teleportBit != (client->ps.eFlags & EF_TELEPORT_BIT))
+	{
+		return qfalse;
+	}
+
+	older = newer;
+	for (n = 1; n < client->historyCount; n++)
+	{
+		older = &client->history[(client->historyHead - n) & (CLIENT_HISTORY_SIZE - 1)];
+		if (older->teleportBit != newer->teleportBit)
+		{
+			older = newer;
+			break;
+		}
+		if (older->time <= time)
+		{
+			break;
+		}
+		newer = older;
+	}
+
+	if (older == newer || older->time >= newer->time)
+	{
+		// as far back as it goes
+		VectorCopy(newer->origin, origin);
+		frac = 1;
+	}
+	else
+	{
+		frac = (float)(time - older->time) / (newer->time - older->time);
+		if (frac < 0)
+		{
+			frac = 0;
+		}
+		for (i = 0; i < 3; i++)
+		{
+			origin[i] = older->origin[i] + frac * (newer->origin[i] - older->origin[i]);
+		}
+	}
+
+	// boxes snap, crouching doesn't lerp either
+	for (i = 0; i < 3; i++)
+	{
+		mins[i] = frac < 0.5f ? older->mins[i] : newer->mins[i];
+		maxs[i] = frac < 0.5f ? older->maxs[i] : newer->maxs[i];
+	}
+	return qtrue;
+}
+
+/*
+===============
+G_BoxNearShot
+
+Whether a box around origin can be touched by a shot from start to end
+that fans out to spread units to the side at end
+===============
+*/
+static qboolean G_BoxNearShot(const vec3_t origin, const vec3_t mins, const vec3_t maxs,
+	const vec3_t start, const vec3_t dir, float length, float spread)
+{
+	vec3_t	center, delta;
+	float	along, radius;
+	int		i;
+
+	for (i = 0; i < 3; i++)
+	{
+		center[i] = origin[i] + 0.5f * (mins[i] + maxs[i]);
+	}
+	radius = 0.5f * Distance(mins, maxs);
+
+	VectorSubtract(center, start, delta);
+	along = DotProduct(delta, dir);
+	if (along < -radius || along > length + radius)
+	{
+		return qfalse;
+	}
+	if (along < 0)
+	{
+		along = 0;
+	}
+	else if (along > length)
+	{
+		along = length;
+	}
+	VectorMA(delta, -along, dir, delta);
+
+	radius += 16 + spread * along / length;
+	return VectorLengthSquared(delta) <= radius * radius;
+}
+
+/*
+===============
+G_RewindClients
+
+Moves the clients the shot can reach back to where the attacker saw them
+according to their last usercmd.  Must be paired with G_RestoreClients.
+===============
+*/
+static void G_RewindClients(gentity_t *attacker, const vec3_t start, const vec3_t end, float spread)
+{
+	gentity_t		*ent;
+	rewoundClient_t	*rc;
+	vec3_t			dir, origin, mins, maxs;
+	float			length;
+	int				time;
+	int				i;
+
+	s_numRewound = 0;
+
+	if (!g_lagCompensation.integer || !attacker->client
+		|| (attacker->r.svFlags & SVF_BOT))
+	{
+		return;
+	}
+
+	time = attacker->client->pers.cmd.serverTime;
+	if (time >= level.time)
+	{
+		return;
+	}
+	if (level.time - time > g_lagCompMaxMsec.integer)
+	{
+		time = level.time - g_lagCompMaxMsec.integer;
+	}
+
+	VectorSubtract(end, start, dir);
+	length = VectorNormalize(dir);
+	if (length < 1)
+	{
+		return;
+	}
+
+	for (i = 0, ent = g_entities; i < level.maxclients; i++, ent++)
+	{
+		if (ent == attacker || !ent->inuse || !ent->client || !ent->r.linked || !ent->r.contents)
+		{
+			continue;
+		}
+		if (ent->client->pers.connected != CON_CONNECTED)
+		{
+			continue;
+		}
+		if (!G_ClientHistoryAt(ent->client, time, origin, mins, maxs))
+		{
+			continue;
+		}
+		if (!G_BoxNearShot(origin, mins, maxs, start, dir, length, spread)
+			&& !G_BoxNearShot(ent->r.currentOrigin, ent->r.mins, ent->r.maxs, start, dir, length, spread))
+		{
+			continue;
+		}
+
+		rc = &s_rewound[s_numRewound++];
+		rc->ent = ent;
+		VectorCopy(ent->r.currentOrigin, rc->origin);
+		VectorCopy(ent->r.mins, rc->mins);
+		VectorCopy(ent->r.maxs, rc->maxs);
+		VectorCopy(origin, rc->rewoundOrigin);
+		VectorCopy(mins, rc->rewoundMins);
+		VectorCopy(maxs, rc->rewoundMaxs);
+
+		VectorCopy(origin, ent->r.currentOrigin);
+		VectorCopy(mins, ent->r.mins);
+		VectorCopy(maxs, ent->r.maxs);
+		trap_LinkEntity(ent);
+	}
+}
+
+/*
+===============
+G_RestoreClients
+
+Puts the clients moved by G_RewindClients back.  Whatever the shot itself
+changed (a kill shrinking the box, a teleport) is left alone.
+===============
+*/
+static void G_RestoreClients(void)
+{
+	rewoundClient_t	*rc;
+	gentity_t		*ent;
+	int				i;
+
+	for (i = 0, rc = s_rewound; i < s_numRewound; i++, rc++)
+	{
+		ent = rc->ent;
+		if (!ent->inuse || !ent->client)
+		{
+			continue;
+		}
+		if (VectorCompare(ent->r.currentOrigin, rc->rewoundOrigin))
+		{
+			VectorCopy(rc->origin, ent->r.currentOrigin);
+		}
+		if (VectorCompare(ent->r.mins, rc->rewoundMins) && VectorCompare(ent->r.maxs, rc->rewoundMaxs))
+		{
+			VectorCopy(rc->mins, ent->r.mins);
+			VectorCopy(rc->maxs, ent->r.maxs);
+		}
+		if (ent->r.linked)
+		{
+			trap_LinkEntity(ent);
+		}
+	}
+	s_numRewound = 0;
+}
+
+
 /*
 ======================================================================
 
@@ -137,7 +425,9 @@ qboolean CheckGauntletAttack(gentity_t *ent)
 	VectorSet(mins, -5, -5, -5);
 	VectorSet(maxs, 5, 5, 5);
 
+	G_RewindClients(ent, muzzle, end, 0);
 	trap_Trace (&tr, muzzle, mins, maxs, end, ent->s.number, MASK_SHOT);
+	G_RestoreClients();
 	if (tr.surfaceFlags & SURF_NOIMPACT)
 	{
 		return qfalse;
@@ -235,6 +525,129 @@ void SnapVectorTowards(vec3_t v, vec3_t to)
 	}
 }
 
+/*
+======================================================================
+
+BULLET IMPACTS
+
+Every bullet used to send its own temp entity, and a chaingun hitting
+a wall kept a dozen of them in each snapshot. The impacts of a frame are
+held here and go out merged per shooter as EV_BULLET_HITS, up to
+MAX_BULLET_IMPACTS to an event. An impact that ends up alone is sent as
+the usual EV_BULLET_HIT_WALL or EV_BULLET_HIT_FLESH.
+
+======================================================================
+*/
+
+#define	MAX_BULLET_EVENTS		64
+#define	BULLET_EVENT_RANGE		512		// impacts further from the first one start another event
+
+typedef struct
+{
+	int			shooter;
+	int			count;
+	vec3_t		origins[MAX_BULLET_IMPACTS];
+	int			bits[MAX_BULLET_IMPACTS];
+} bulletEvent_t;
+
+static bulletEvent_t	bulletEvents[MAX_BULLET_EVENTS];
+static int				numBulletEvents;
+
+/*
+================
+G_AddBulletImpact
+
+Origin must already be snapped
+================
+*/
+static void G_AddBulletImpact(gentity_t *shooter, vec3_t origin, int bits)
+{
+	bulletEvent_t	*be;
+	int				i;
+
+	for (i = 0, be = bulletEvents; i < numBulletEvents; i++, be++)
+	{
+		if (be->shooter == shooter->s.number && be->count < MAX_BULLET_IMPACTS
+			&& DistanceSquared(be->origins[0], origin) < Square(BULLET_EVENT_RANGE))
+		{
+			break;
+		}
+	}
+
+	if (i == numBulletEvents)
+	{
+		if (numBulletEvents == MAX_BULLET_EVENTS)
+		{
+			G_FlushBulletImpacts();
+		}
+		be = &bulletEvents[numBulletEvents++];
+		be->shooter = shooter->s.number;
+		be->count = 0;
+	}
+
+	VectorCopy(origin, be->origins[be->count]);
+	be->bits[be->count] = bits;
+	be->count++;
+}
+
+/*
+================
+G_FlushBulletImpacts
+
+Sends the impacts held since the last flush, once a frame
+================
+*/
+void G_FlushBulletImpacts(void)
+{
+	bulletEvent_t	*be;
+	gentity_t		*tent;
+	int				i, n, j;
+
+	for (i = 0, be = bulletEvents; i < numBulletEvents; i++, be++)
+	{
+		if (be->count == 1)
+		{
+			if (be->bits[0] & BULLET_IMPACT_FLESH)
+			{
+				tent = G_TempEntity(be->origins[0], EV_BULLET_HIT_FLESH);
+			}
+			else
+			{
+				tent = G_TempEntity(be->origins[0], EV_BULLET_HIT_WALL);
+			}
+			tent->s.eventParm = be->bits[0] & 255;
+			tent->s.otherEntityNum = be->shooter;
+			tent->s.weapon = (be->bits[0] & BULLET_IMPACT_TRACER) != 0;
+			continue;
+		}
+
+		tent = G_TempEntity(be->origins[0], EV_BULLET_HITS);
+		tent->s.eventParm = be->count;
+		tent->s.otherEntityNum = be->shooter;
+		for (n = 0; n < be->count; n++)
+		{
+			VectorCopy(be->origins[n], BG_BulletImpactOrigin(&tent->s, n));
+			BG_SetBulletImpact(&tent->s, n, be->bits[n]);
+
+			// link over all the impacts, so it reaches everyone who sees one
+			for (j = 0; j < 3; j++)
+			{
+				if (be->origins[n][j] - be->origins[0][j] < tent->r.mins[j])
+				{
+					tent->r.mins[j] = be->origins[n][j] - be->origins[0][j];
+				}
+				else if (be->origins[n][j] - be->origins[0][j] > tent->r.maxs[j])
+				{
+					tent->r.maxs[j] = be->origins[n][j] - be->origins[0][j];
+				}
+			}
+		}
+		trap_LinkEntity(tent);
+	}
+
+	numBulletEvents = 0;
+}
+
 #ifdef MISSIONPACK
 #define CHAINGUN_SPREAD		600
 #endif
@@ -255,7 +668,6 @@ void Bullet_Fire(gentity_t *ent, float spread, int damage, meansOfDeath_t Mod, q
 #endif
 	float		r;
 	float		u;
-	gentity_t	*tent;
 	gentity_t	*traceEnt;
 	int			i, passent;
 
@@ -268,6 +680,8 @@ void Bullet_Fire(gentity_t *ent, float spread, int damage, meansOfDeath_t Mod, q
 	VectorMA (end, r, right, end);
 	VectorMA (end, u, up, end);
 
+	G_RewindClients(ent, muzzle, end, 0);
+
 	passent = ent->s.number;
 	for (i = 0; i < 10; i++)
 	{
@@ -275,7 +689,7 @@ void Bullet_Fire(gentity_t *ent, float spread, int damage, meansOfDeath_t Mod, q
 		trap_Trace (&tr, muzzle, NULL, NULL, end, passent, MASK_SHOT);
 		if (tr.surfaceFlags & SURF_NOIMPACT)
 		{
-			return;
+			break;
 		}
 
 		traceEnt = &g_entities[tr.entityNum];
@@ -286,8 +700,8 @@ void Bullet_Fire(gentity_t *ent, float spread, int damage, meansOfDeath_t Mod, q
 		// send bullet impact
 		if (traceEnt->takedamage && traceEnt->client)
 		{
-			tent = G_TempEntity(tr.endpos, EV_BULLET_HIT_FLESH);
-			tent->s.eventParm = traceEnt->s.number;
+			G_AddBulletImpact(ent, tr.endpos, BULLET_IMPACT_FLESH | traceEnt->s.number
+				| (Tracer ? BULLET_IMPACT_TRACER : 0));
 			if (LogAccuracyHit(traceEnt, ent))
 			{
 				ent->client->accuracy_hits++;
@@ -295,11 +709,9 @@ void Bullet_Fire(gentity_t *ent, float spread, int damage, meansOfDeath_t Mod, q
 		}
 		else
 		{
-			tent = G_TempEntity(tr.endpos, EV_BULLET_HIT_WALL);
-			tent->s.eventParm = DirToByte(tr.plane.normal);
+			G_AddBulletImpact(ent, tr.endpos, DirToByte(tr.plane.normal)
+				| (Tracer ? BULLET_IMPACT_TRACER : 0));
 		}
-		tent->s.otherEntityNum = ent->s.number;
-		tent->s.weapon = Tracer;
 
 		if (traceEnt->takedamage)
 		{
@@ -331,6 +743,8 @@ void Bullet_Fire(gentity_t *ent, float spread, int damage, meansOfDeath_t Mod, q
 		}
 		break;
 	}
+
+	G_RestoreClients();
 }
 
 
@@ -458,6 +872,11 @@ void ShotgunPattern(vec3_t origin, vec3_t origin2, int seed, gentity_t *ent, int
 
 	oldScore = ent->client->ps.persistant[PERS_SCORE];
 
+	// one rewind covers the whole pattern
+	VectorMA(origin, 8192 * 16, forward, end);
+	G_RewindClients(ent, origin, end,
+		((Parm & WP_FIRE2BIT) ? HEAVY_SHOTGUN_SPREAD : DEFAULT_SHOTGUN_SPREAD) * 16 * 1.5f);
+
 	// generate the "random" spread pattern
 	for (i = 0; i < DEFAULT_SHOTGUN_COUNT; i++)
 	{
@@ -484,6 +903,8 @@ void ShotgunPattern(vec3_t origin, vec3_t origin2, int seed, gentity_t *ent, int
 			ent->client->accuracy_hits++;
 		}
 	}
+
+	G_RestoreClients();
 }
 
 
@@ -604,6 +1025,12 @@ void Weapon_FlameThrower_Fire (gentity_t *ent, int Parm)
 
 	VectorNormalize(forward);
 
+	if (g_flameStream.integer)
+	{
+		fire_FlameStream(ent, muzzle, forward, Parm, s_quadFactor);
+		return;
+	}
+
 	m = fire_Flame(ent, muzzle, forward, Parm);
 	m->damage *= s_quadFactor;
 	m->splashDamage *= s_quadFactor;
@@ -651,6 +1078,8 @@ void weapon_railgun_fire (gentity_t *ent)
 
 	VectorMA (muzzle, 8192, forward, end);
 
+	G_RewindClients(ent, muzzle, end, 0);
+
 	// trace only against the solids, so the railgun will go through people
 	unlinked = 0;
 	hits = 0;
@@ -721,6 +1150,8 @@ void weapon_railgun_fire (gentity_t *ent)
 		trap_LinkEntity(unlinkedEntities[i]);
 	}
 
+	G_RestoreClients();
+
 	// the final trace endpos will be the terminal point of the rail trail
 
 	// snap the endpos to integers to save net bandwidth, but nudged towards the line
@@ -833,6 +1264,9 @@ void Weapon_LightningFire(gentity_t *ent)
 
 	damage = 8 * s_quadFactor;
 
+	VectorMA(muzzle, LIGHTNING_RANGE, forward, end);
+	G_RewindClients(ent, muzzle, end, 0);
+
 	passent = ent->s.number;
 	for (i = 0; i < 10; i++)
 	{
@@ -855,7 +1289,7 @@ void Weapon_LightningFire(gentity_t *ent)
 #endif
 		if (tr.entityNum == ENTITYNUM_NONE)
 		{
-			return;
+			break;
 		}
 
 		traceEnt = &g_entities[ tr.entityNum ];
@@ -911,6 +1345,8 @@ void Weapon_LightningFire(gentity_t *ent)
 
 		break;
 	}
+
+	G_RestoreClients();
 }
 
 #ifdef MISSIONPACK
@@ -1370,7 +1806,7 @@ static void KamikazeDamage(gentity_t *self)
 		G_FreeEntity(self);
 		return;
 	}
-	self->nextthink = level.time + 100;
+	G_SetNextThink(self, level.time + 100);
 
 	// add earth quake effect
 	newangles[0] = crandom() * 2;
@@ -1432,7 +1868,7 @@ void G_StartKamikaze(gentity_t *ent)
 	explosion->kamikazeTime = level.time;
 
 	explosion->think = KamikazeDamage;
-	explosion->nextthink = level.time + 100;
+	G_SetNextThink(explosion, level.time + 100);
 	explosion->count = 0;
 	VectorClear(explosion->movedir);
 
@@ -15,9 +15,13 @@
 
 int				ui_numBots;
 static char		*ui_botInfos[MAX_BOTS];
+static infoRecord_t	ui_botRecords[MAX_BOTS];
+static infoTable_t	ui_botTable;
 
 static int		ui_numArenas;
 static char		*ui_arenaInfos[MAX_ARENAS];
+static infoRecord_t	ui_arenaRecords[MAX_ARENAS];
+static infoTable_t	ui_arenaTable;
 
 static int		ui_numSinglePlayerArenas;
 static int		ui_numSpecialSinglePlayerArenas;
@@ -66,63 +70,7 @@ UI_ParseInfos
 */
 int UI_ParseInfos(char *buf, int max, char *infos[])
 {
-	char	*token;
-	int		count;
-	char	key[MAX_TOKEN_CHARS];
-	char	info[MAX_INFO_STRING];
-
-	count = 0;
-
-	while (1)
-	{
-		token = COM_Parse(&buf);
-		if (!token[0])
-		{
-			break;
-		}
-		if (strcmp(token, "{"))
-		{
-			Com_Printf("Missing { in info file\n");
-			break;
-		}
-
-		if (count == max)
-		{
-			Com_Printf("Max infos exceeded\n");
-			break;
-		}
-
-		info[0] = '\0';
-		while (1)
-		{
-			token = COM_ParseExt(&buf, qtrue);
-			if (!token[0])
-			{
-				Com_Printf("Unexpected end of info file\n");
-				break;
-			}
-			if (!strcmp(token, "}"))
-			{
-				break;
-			}
-			Q_strncpyz(key, token, sizeof(key));
-
-			token = COM_ParseExt(&buf, qfalse);
-			if (!token[0])
-			{
-				strcpy(token, "<NULL>");
-			}
-			Info_SetValueForKey(info, key, token);
-		}
-		//NOTE: extra space for arena number
-		infos[count] = UI_Alloc(strlen(info) + strlen("\\num\\") + strlen(va("%d", MAX_ARENAS)) + 1);
-		if (infos[count])
-		{
-			strcpy(infos[count], info);
-			count++;
-		}
-	}
-	return count;
+	return BG_ParseInfos(buf, max, infos, UI_Alloc);
 }
 
 /*
@@ -269,6 +217,8 @@ static void UI_LoadArenas(void)
 
 		Info_SetValueForKey(ui_arenaInfos[n], "num", va("%i", otherNum++));
 	}
+
+	BG_IndexInfos(&ui_arenaTable, ui_arenaRecords, ui_arenaInfos, ui_numArenas, "map");
 }
 
 /*
@@ -302,22 +252,19 @@ const char *UI_GetArenaInfoByNumber(int num)
 
 /*
 ===============
-UI_GetArenaInfoByNumber
+UI_GetArenaInfoByMap
 ===============
 */
 const char *UI_GetArenaInfoByMap(const char *map)
 {
-	int			n;
+	infoRecord_t	*rec;
 
-	for (n = 0; n < ui_numArenas; n++)
+	rec = BG_FindInfo(&ui_arenaTable, map);
+	if (!rec)
 	{
-		if (Q_stricmp(Info_ValueForKey(ui_arenaInfos[n], "map"), map) == 0)
-		{
-			return ui_arenaInfos[n];
-		}
+		return NULL;
 	}
-
-	return NULL;
+	return rec->info;
 }
 
 
@@ -411,6 +358,8 @@ static void UI_LoadBots(void)
 		UI_LoadBotsFromFile(filename);
 	}
 	trap_Print(va("%i bots parsed\n", ui_numBots));
+
+	BG_IndexInfos(&ui_botTable, ui_botRecords, ui_botInfos, ui_numBots, "name");
 }
 
 
@@ -437,19 +386,14 @@ UI_GetBotInfoByName
 */
 char *UI_GetBotInfoByName(const char *name)
 {
-	int		n;
-	char	*value;
+	infoRecord_t	*rec;
 
-	for (n = 0; n < ui_numBots; n++)
+	rec = BG_FindInfo(&ui_botTable, name);
+	if (!rec)
 	{
-		value = Info_ValueForKey(ui_botInfos[n], "name");
-		if (!Q_stricmp(value, name))
-		{
-			return ui_botInfos[n];
-		}
+		return NULL;
 	}
-
-	return NULL;
+	return rec->info;
 }
 
 
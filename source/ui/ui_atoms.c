@@ -361,6 +361,12 @@ qboolean UI_ConsoleCommand(int realTime)
 		return qtrue;
 	}
 
+	if (Q_stricmp (cmd, "ui_compileMenus") == 0)
+	{
+		UI_CompileMenus();
+		return qtrue;
+	}
+
 	if (Q_stricmp (cmd, "remapShader") == 0)
 	{
 		if (trap_Argc() == 4)
@@ -14,6 +14,8 @@
 
 int				ui_numBots;
 static char		*ui_botInfos[MAX_BOTS];
+static infoRecord_t	ui_botRecords[MAX_BOTS];
+static infoTable_t	ui_botTable;
 
 static int		ui_numArenas;
 static char		*ui_arenaInfos[MAX_ARENAS];
@@ -28,63 +30,7 @@ UI_ParseInfos
 */
 int UI_ParseInfos(char *buf, int max, char *infos[])
 {
-	char	*token;
-	int		count;
-	char	key[MAX_TOKEN_CHARS];
-	char	info[MAX_INFO_STRING];
-
-	count = 0;
-
-	while (1)
-	{
-		token = COM_Parse(&buf);
-		if (!token[0])
-		{
-			break;
-		}
-		if (strcmp(token, "{"))
-		{
-			Com_Printf("Missing { in info file\n");
-			break;
-		}
-
-		if (count == max)
-		{
-			Com_Printf("Max infos exceeded\n");
-			break;
-		}
-
-		info[0] = '\0';
-		while (1)
-		{
-			token = COM_ParseExt(&buf, qtrue);
-			if (!token[0])
-			{
-				Com_Printf("Unexpected end of info file\n");
-				break;
-			}
-			if (!strcmp(token, "}"))
-			{
-				break;
-			}
-			Q_strncpyz(key, token, sizeof(key));
-
-			token = COM_ParseExt(&buf, qfalse);
-			if (!token[0])
-			{
-				strcpy(token, "<NULL>");
-			}
-			Info_SetValueForKey(info, key, token);
-		}
-		//NOTE: extra space for arena number
-		infos[count] = UI_Alloc(strlen(info) + strlen("\\num\\") + strlen(va("%d", MAX_ARENAS)) + 1);
-		if (infos[count])
-		{
-			strcpy(infos[count], info);
-			count++;
-		}
-	}
-	return count;
+	return BG_ParseInfos(buf, max, infos, UI_Alloc);
 }
 
 /*
@@ -132,7 +78,6 @@ void UI_LoadArenas(void)
 	char*		dirptr;
 	int			i, n;
 	int			dirlen;
-	char		*type;
 
 	ui_numArenas = 0;
 	uiInfo.mapCount = 0;
@@ -178,54 +123,7 @@ void UI_LoadArenas(void)
 
 		uiInfo.mapList[uiInfo.mapCount].levelShot = -1;
 		uiInfo.mapList[uiInfo.mapCount].imageName = String_Alloc(va("levelshots/%s", uiInfo.mapList[uiInfo.mapCount].mapLoadName));
-		uiInfo.mapList[uiInfo.mapCount].typeBits = 0;
-
-		type = Info_ValueForKey(ui_arenaInfos[n], "type");
-		// if no type specified, it will be treated as "ffa"
-		if (*type)
-		{
-			if (strstr(type, "ffa"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_FFA);
-			}
-			if (strstr(type, "tourney"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_TOURNAMENT);
-			}
-			if (strstr(type, "ctf"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_CTF);
-			}
-			if (strstr(type, "inv"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_INVASION);
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_DESTROY);
-			}
-			if (strstr(type, "tte"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_INVASION);
-			}
-			if (strstr(type, "dae"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_DESTROY);
-			}
-			/*if (strstr(type, "oneflag"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_1FCTF);
-			}
-			if (strstr(type, "overload"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_OBELISK);
-			}
-			if (strstr(type, "harvester"))
-			{
-				uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_HARVESTER);
-			}*/
-		}
-		else
-		{
-			uiInfo.mapList[uiInfo.mapCount].typeBits |= (1 << GT_FFA);
-		}
+		uiInfo.mapList[uiInfo.mapCount].typeBits = BG_ArenaGametypes(Info_ValueForKey(ui_arenaInfos[n], "type"));
 
 		uiInfo.mapCount++;
 		if (uiInfo.mapCount >= MAX_MAPS)
@@ -307,6 +205,8 @@ void UI_LoadBots(void)
 		UI_LoadBotsFromFile(filename);
 	}
 	trap_Print(va("%i bots parsed\n", ui_numBots));
+
+	BG_IndexInfos(&ui_botTable, ui_botRecords, ui_botInfos, ui_numBots, "name");
 }
 
 
@@ -333,19 +233,14 @@ UI_GetBotInfoByName
 */
 char *UI_GetBotInfoByName(const char *name)
 {
-	int		n;
-	char	*value;
+	infoRecord_t	*rec;
 
-	for (n = 0; n < ui_numBots; n++)
+	rec = BG_FindInfo(&ui_botTable, name);
+	if (!rec)
 	{
-		value = Info_ValueForKey(ui_botInfos[n], "name");
-		if (!Q_stricmp(value, name))
-		{
-			return ui_botInfos[n];
-		}
+		return NULL;
 	}
-
-	return NULL;
+	return rec->info;
 }
 
 int UI_GetNumBots()
@@ -110,6 +110,7 @@ extern vmCvar_t	ui_scoreTime;
 extern vmCvar_t	ui_smallFont;
 extern vmCvar_t	ui_bigFont;
 extern vmCvar_t ui_serverStatusTimeOut;
+extern vmCvar_t	ui_menuCache;
 
 
 
@@ -345,6 +346,7 @@ extern sfxHandle_t	MenuField_Key(menufield_s* m, int* key);
 //
 void UI_Report();
 void UI_Load();
+void UI_CompileMenus();
 void UI_LoadMenus(const char *menuFile, qboolean reset);
 void _UI_SetActiveMenu(uiMenuCommand_t menu);
 int UI_AdjustTimeByGame(int time);
@@ -709,6 +711,24 @@ typedef struct
 pinglist_t;
 
 
+// the fields of a LAN server info string the browser filters and sorts on,
+// parsed once and kept until the info string of that server changes
+typedef struct
+{
+	qboolean	valid;
+	qboolean	inDisplayList;
+	int		infoHash;
+	int		ping;
+	int		clients;
+	int		maxClients;
+	int		gameType;
+	int		netType;
+	char	hostName[MAX_NAME_LENGTH];
+	char	mapName[MAX_NAME_LENGTH];
+	char	game[MAX_NAME_LENGTH];
+}
+uiServerInfo_t;
+
 typedef struct serverStatus_s
 {
 	pinglist_t pingList[MAX_PINGREQUESTS];
@@ -724,6 +744,7 @@ typedef struct serverStatus_s
 	qboolean refreshActive;
 	int		currentServer;
 	int		displayServers[MAX_DISPLAY_SERVERS];
+	uiServerInfo_t serverInfo[MAX_DISPLAY_SERVERS];	// indexed by LAN server number
 	int		numDisplayServers;
 	int		numPlayersOnServers;
 	int		nextDisplayRefresh;
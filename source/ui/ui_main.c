@@ -120,6 +120,8 @@ static void UI_BuildServerDisplayList(qboolean force);
 static void UI_BuildServerStatus(qboolean force);
 static void UI_BuildFindPlayerList(qboolean force);
 static int QDECL UI_ServersQsortCompare(const void *arg1, const void *arg2);
+static int UI_CompareServers(int num1, int num2);
+static void UI_ClearServerDisplayList(void);
 static int UI_MapCountByGameType(qboolean singlePlayer);
 static void UI_ParseGameInfo(const char *teamFile);
 static void UI_ParseTeamInfo(const char *teamFile);
@@ -960,7 +962,9 @@ void UI_Report()
 
 }
 
-void UI_ParseMenu(const char *menuFile)
+static qboolean uiCompileMenus = qfalse;
+
+static void UI_ParseMenuSource(const char *menuFile)
 {
 	int handle;
 	pc_token_t token;
@@ -1017,6 +1021,53 @@ void UI_ParseMenu(const char *menuFile)
 	trap_PC_FreeSource(handle);
 }
 
+/*
+=================
+UI_ParseMenu
+
+Menu files are parsed once and loaded from the menu cache after that,
+see MenuCache_Load.
+=================
+*/
+void UI_ParseMenu(const char *menuFile)
+{
+	if (!ui_menuCache.integer)
+	{
+		UI_ParseMenuSource(menuFile);
+		return;
+	}
+
+	if (!uiCompileMenus && MenuCache_Load(menuFile, UI_ParseMenuSource))
+	{
+		return;
+	}
+
+	MenuCache_Begin();
+	UI_ParseMenuSource(menuFile);
+	MenuCache_End(menuFile);
+}
+
+/*
+=================
+UI_CompileMenus
+
+Parses all menu files again and rewrites their caches.
+=================
+*/
+void UI_CompileMenus()
+{
+	if (!ui_menuCache.integer)
+	{
+		Com_Printf("ui_menuCache is off\n");
+		return;
+	}
+
+	uiCompileMenus = qtrue;
+	UI_Load();
+	UI_LoadMenus("ui/ingame.txt", qfalse);
+	uiCompileMenus = qfalse;
+}
+
 qboolean Load_Menu(int handle)
 {
 	pc_token_t token;
@@ -3291,7 +3342,7 @@ UI_ServersQsortCompare
 */
 static int QDECL UI_ServersQsortCompare(const void *arg1, const void *arg2)
 {
-	return trap_LAN_CompareServers(ui_netSource.integer, uiInfo.serverStatus.sortKey, uiInfo.serverStatus.sortDir, *(int*)arg1, *(int*)arg2);
+	return UI_CompareServers(*(int*)arg1, *(int*)arg2);
 }
 
 
@@ -4336,6 +4387,134 @@ static int UI_MapCountByGameType(qboolean singlePlayer)
 	return c;
 }
 
+/*
+==================
+UI_HashInfoString
+==================
+*/
+static int UI_HashInfoString(const char *s)
+{
+	int hash;
+
+	hash = 5381;
+	while (*s)
+	{
+		hash = (hash << 5) + hash + *s++;
+	}
+	return hash;
+}
+
+/*
+==================
+UI_ParseServerInfo
+
+Pulls the info string of a LAN server and parses the fields the
+browser works with, unless it didn't change since the last time.
+Returns qtrue if the server has to be filtered and placed again
+==================
+*/
+static qboolean UI_ParseServerInfo(int num)
+{
+	char info[MAX_STRING_CHARS];
+	uiServerInfo_t *server;
+	int hash;
+
+	server = &uiInfo.serverStatus.serverInfo[num];
+
+	trap_LAN_GetServerInfo(ui_netSource.integer, num, info, MAX_STRING_CHARS);
+	hash = UI_HashInfoString(info);
+	if (server->valid && server->infoHash == hash)
+	{
+		return qfalse;
+	}
+
+	server->valid = qtrue;
+	server->infoHash = hash;
+	server->ping = atoi(Info_ValueForKey(info, "ping"));
+	server->clients = atoi(Info_ValueForKey(info, "clients"));
+	server->maxClients = atoi(Info_ValueForKey(info, "sv_maxclients"));
+	server->gameType = atoi(Info_ValueForKey(info, "gametype"));
+	server->netType = atoi(Info_ValueForKey(info, "nettype"));
+	if (server->netType < 0 || server->netType > 2)
+	{
+		server->netType = 0;
+	}
+	Q_strncpyz(server->hostName, Info_ValueForKey(info, "hostname"), sizeof(server->hostName));
+	Q_strncpyz(server->mapName, Info_ValueForKey(info, "mapname"), sizeof(server->mapName));
+	Q_strncpyz(server->game, Info_ValueForKey(info, "game"), sizeof(server->game));
+	return qtrue;
+}
+
+/*
+==================
+UI_CompareServers
+
+Same ordering as trap_LAN_CompareServers, from the parsed info
+==================
+*/
+static int UI_CompareServers(int num1, int num2)
+{
+	uiServerInfo_t *server1, *server2;
+	int res;
+
+	server1 = &uiInfo.serverStatus.serverInfo[num1];
+	server2 = &uiInfo.serverStatus.serverInfo[num2];
+
+	switch (uiInfo.serverStatus.sortKey)
+	{
+		case SORT_HOST :
+			res = Q_stricmp(server1->hostName, server2->hostName);
+			break;
+		case SORT_MAP :
+			res = Q_stricmp(server1->mapName, server2->mapName);
+			break;
+		case SORT_CLIENTS :
+			res = server1->clients - server2->clients;
+			break;
+		case SORT_GAME :
+			res = server1->gameType - server2->gameType;
+			break;
+		case SORT_PING :
+			res = server1->ping - server2->ping;
+			break;
+		default :
+			res = 0;
+			break;
+	}
+
+	if (res < 0)
+	{
+		res = -1;
+	}
+	else if (res > 0)
+	{
+		res = 1;
+	}
+
+	if (uiInfo.serverStatus.sortDir)
+	{
+		return -res;
+	}
+	return res;
+}
+
+/*
+==================
+UI_ClearServerDisplayList
+==================
+*/
+static void UI_ClearServerDisplayList(void)
+{
+	int i;
+
+	for (i = 0; i < uiInfo.serverStatus.numDisplayServers; i++)
+	{
+		uiInfo.serverStatus.serverInfo[uiInfo.serverStatus.displayServers[i]].inDisplayList = qfalse;
+	}
+	uiInfo.serverStatus.numDisplayServers = 0;
+	uiInfo.serverStatus.numPlayersOnServers = 0;
+}
+
 /*
 ==================
 UI_InsertServerIntoDisplayList
@@ -4345,7 +4524,8 @@ static void UI_InsertServerIntoDisplayList(int num, int position)
 {
 	int i;
 
-	if (position < 0 || position > uiInfo.serverStatus.numDisplayServers)
+	if (position < 0 || position > uiInfo.serverStatus.numDisplayServers
+		|| uiInfo.serverStatus.numDisplayServers >= MAX_DISPLAY_SERVERS - 1)
 	{
 		return;
 	}
@@ -4356,6 +4536,7 @@ static void UI_InsertServerIntoDisplayList(int num, int position)
 		uiInfo.serverStatus.displayServers[i] = uiInfo.serverStatus.displayServers[i-1];
 	}
 	uiInfo.serverStatus.displayServers[position] = num;
+	uiInfo.serverStatus.serverInfo[num].inDisplayList = qtrue;
 }
 
 /*
@@ -4367,6 +4548,12 @@ static void UI_RemoveServerFromDisplayList(int num)
 {
 	int i, j;
 
+	if (!uiInfo.serverStatus.serverInfo[num].inDisplayList)
+	{
+		return;
+	}
+	uiInfo.serverStatus.serverInfo[num].inDisplayList = qfalse;
+
 	for (i = 0; i < uiInfo.serverStatus.numDisplayServers; i++)
 	{
 		if (uiInfo.serverStatus.displayServers[i] == num)
@@ -4399,8 +4586,7 @@ static void UI_BinaryServerInsertion(int num)
 	{
 		mid = len >> 1;
 		//
-		res = trap_LAN_CompareServers(ui_netSource.integer, uiInfo.serverStatus.sortKey,
-					uiInfo.serverStatus.sortDir, num, uiInfo.serverStatus.displayServers[offset+mid]);
+		res = UI_CompareServers(num, uiInfo.serverStatus.displayServers[offset+mid]);
 		// if equal
 		if (res == 0)
 		{
@@ -4433,8 +4619,8 @@ UI_BuildServerDisplayList
 */
 static void UI_BuildServerDisplayList(qboolean force)
 {
-	int i, count, clients, maxClients, ping, game, len, visible;
-	char info[MAX_STRING_CHARS];
+	int i, count, clients, ping, len, visible;
+	uiServerInfo_t *server;
 	qboolean startRefresh = qtrue;
 	static int numinvisible;
 
@@ -4468,8 +4654,7 @@ static void UI_BuildServerDisplayList(qboolean force)
 	{
 		numinvisible = 0;
 		// clear number of displayed servers
-		uiInfo.serverStatus.numDisplayServers = 0;
-		uiInfo.serverStatus.numPlayersOnServers = 0;
+		UI_ClearServerDisplayList();
 		// set list box index to zero
 		Menu_SetFeederSelection(NULL, FEEDER_SERVERS, 0, NULL);
 		// mark all servers as visible so we store ping updates for them
@@ -4481,12 +4666,16 @@ static void UI_BuildServerDisplayList(qboolean force)
 	if (count == -1 || (ui_netSource.integer == AS_LOCAL && count == 0))
 	{
 		// still waiting on a response from the master
-		uiInfo.serverStatus.numDisplayServers = 0;
-		uiInfo.serverStatus.numPlayersOnServers = 0;
+		UI_ClearServerDisplayList();
 		uiInfo.serverStatus.nextDisplayRefresh = uiInfo.uiDC.realTime + 500;
 		return;
 	}
 
+	if (count > MAX_DISPLAY_SERVERS)
+	{
+		count = MAX_DISPLAY_SERVERS;
+	}
+
 	visible = qfalse;
 	for (i = 0; i < count; i++)
 	{
@@ -4500,15 +4689,33 @@ static void UI_BuildServerDisplayList(qboolean force)
 		ping = trap_LAN_GetServerPing(ui_netSource.integer, i);
 		if (ping > 0 || ui_netSource.integer == AS_FAVORITES)
 		{
+			server = &uiInfo.serverStatus.serverInfo[i];
 
-			trap_LAN_GetServerInfo(ui_netSource.integer, i, info, MAX_STRING_CHARS);
+			if (server->inDisplayList)
+			{
+				// nothing to do if it is already placed and its info didn't change
+				clients = server->clients;
+				if (!UI_ParseServerInfo(i))
+				{
+					if (ping > 0)
+					{
+						trap_LAN_MarkServerVisible(ui_netSource.integer, i, qfalse);
+					}
+					continue;
+				}
+				uiInfo.serverStatus.numPlayersOnServers -= clients;
+				UI_RemoveServerFromDisplayList(i);
+			}
+			else
+			{
+				UI_ParseServerInfo(i);
+			}
 
-			clients = atoi(Info_ValueForKey(info, "clients"));
-			uiInfo.serverStatus.numPlayersOnServers += clients;
+			uiInfo.serverStatus.numPlayersOnServers += server->clients;
 
 			if (ui_browserShowEmpty.integer == 0)
 			{
-				if (clients == 0)
+				if (server->clients == 0)
 				{
 					trap_LAN_MarkServerVisible(ui_netSource.integer, i, qfalse);
 					continue;
@@ -4517,8 +4724,7 @@ static void UI_BuildServerDisplayList(qboolean force)
 
 			if (ui_browserShowFull.integer == 0)
 			{
-				maxClients = atoi(Info_ValueForKey(info, "sv_maxclients"));
-				if (clients == maxClients)
+				if (server->clients == server->maxClients)
 				{
 					trap_LAN_MarkServerVisible(ui_netSource.integer, i, qfalse);
 					continue;
@@ -4527,8 +4733,7 @@ static void UI_BuildServerDisplayList(qboolean force)
 
 			if (uiInfo.joinGameTypes[ui_joinGameType.integer].gtEnum != -1)
 			{
-				game = atoi(Info_ValueForKey(info, "gametype"));
-				if (game != uiInfo.joinGameTypes[ui_joinGameType.integer].gtEnum)
+				if (server->gameType != uiInfo.joinGameTypes[ui_joinGameType.integer].gtEnum)
 				{
 					trap_LAN_MarkServerVisible(ui_netSource.integer, i, qfalse);
 					continue;
@@ -4537,17 +4742,12 @@ static void UI_BuildServerDisplayList(qboolean force)
 
 			if (ui_serverFilterType.integer > 0)
 			{
-				if (Q_stricmp(Info_ValueForKey(info, "game"), serverFilters[ui_serverFilterType.integer].basedir) != 0)
+				if (Q_stricmp(server->game, serverFilters[ui_serverFilterType.integer].basedir) != 0)
 				{
 					trap_LAN_MarkServerVisible(ui_netSource.integer, i, qfalse);
 					continue;
 				}
 			}
-			// make sure we never add a favorite server twice
-			if (ui_netSource.integer == AS_FAVORITES)
-			{
-				UI_RemoveServerFromDisplayList(i);
-			}
 			// insert the server into the list
 			UI_BinaryServerInsertion(i);
 			// done with this server
@@ -4735,27 +4935,6 @@ static int UI_GetServerStatusInfo(const char *serverAddress, serverStatusInfo_t
 	return qfalse;
 }
 
-/*
-==================
-stristr
-==================
-*/
-static char *stristr(char *str, char *charset)
-{
-	int i;
-
-	while(*str)
-	{
-		for (i = 0; charset[i] && str[i]; i++)
-		{
-			if (toupper(charset[i]) != toupper(str[i])) break;
-		}
-		if (!charset[i]) return str;
-		str++;
-	}
-	return NULL;
-}
-
 /*
 ==================
 UI_BuildFindPlayerList
@@ -4764,10 +4943,10 @@ UI_BuildFindPlayerList
 static void UI_BuildFindPlayerList(qboolean force)
 {
 	static numFound, numTimeOuts;
+	static char findName[MAX_NAME_LENGTH+2];	// cleaned and lowercase, like the names it is searched in
 	int i, j, resend;
 	serverStatusInfo_t info;
 	char name[MAX_NAME_LENGTH+2];
-	char infoString[MAX_STRING_CHARS];
 
 	if (!force)
 	{
@@ -4789,6 +4968,8 @@ static void UI_BuildFindPlayerList(qboolean force)
 			uiInfo.nextFindPlayerRefresh = 0;
 			return;
 		}
+		Q_strncpyz(findName, uiInfo.findPlayerName, sizeof(findName));
+		Q_strlwr(findName);
 		// set resend time
 		resend = ui_serverStatusTimeOut.integer / 2 - 10;
 		if (resend < 50)
@@ -4827,8 +5008,9 @@ static void UI_BuildFindPlayerList(qboolean force)
 					// clean string first
 					Q_strncpyz(name, info.lines[j][3], sizeof(name));
 					Q_CleanStr(name);
+					Q_strlwr(name);
 					// if the player name is a substring
-					if (stristr(name, uiInfo.findPlayerName))
+					if (strstr(name, findName))
 					{
 						// add to found server list if we have space (always leave space for a line with the number found)
 						if (uiInfo.numFoundPlayerServers < MAX_FOUNDPLAYER_SERVERS-1)
@@ -4874,8 +5056,9 @@ static void UI_BuildFindPlayerList(qboolean force)
 				uiInfo.pendingServerStatus.server[i].startTime = uiInfo.uiDC.realTime;
 				trap_LAN_GetServerAddressString(ui_netSource.integer, uiInfo.serverStatus.displayServers[uiInfo.pendingServerStatus.num],
 							uiInfo.pendingServerStatus.server[i].adrstr, sizeof(uiInfo.pendingServerStatus.server[i].adrstr));
-				trap_LAN_GetServerInfo(ui_netSource.integer, uiInfo.serverStatus.displayServers[uiInfo.pendingServerStatus.num], infoString, sizeof(infoString));
-				Q_strncpyz(uiInfo.pendingServerStatus.server[i].name, Info_ValueForKey(infoString, "hostname"), sizeof(uiInfo.pendingServerStatus.server[0].name));
+				Q_strncpyz(uiInfo.pendingServerStatus.server[i].name,
+							uiInfo.serverStatus.serverInfo[uiInfo.serverStatus.displayServers[uiInfo.pendingServerStatus.num]].hostName,
+								sizeof(uiInfo.pendingServerStatus.server[0].name));
 				uiInfo.pendingServerStatus.server[i].valid = qtrue;
 				uiInfo.pendingServerStatus.num++;
 				Com_sprintf(uiInfo.foundPlayerServerNames[uiInfo.numFoundPlayerServers-1],
@@ -5074,8 +5257,6 @@ static const char *UI_FeederItemText(float feederID, int index, int column, qhan
 	static char info[MAX_STRING_CHARS];
 	static char hostname[1024];
 	static char clientBuff[32];
-	static lastColumn = -1;
-	static lastTime = 0;
 	*handle = -1;
 	if (feederID == FEEDER_HEADS)
 	{
@@ -5100,24 +5281,15 @@ static const char *UI_FeederItemText(float feederID, int index, int column, qhan
 	{
 		if (index >= 0 && index < uiInfo.serverStatus.numDisplayServers)
 		{
-			int ping, game;
-			if (lastColumn != column || lastTime > uiInfo.uiDC.realTime + 5000)
-			{
-				trap_LAN_GetServerInfo(ui_netSource.integer, uiInfo.serverStatus.displayServers[index], info, MAX_STRING_CHARS);
-				lastColumn = column;
-				lastTime = uiInfo.uiDC.realTime;
-			}
-			ping = atoi(Info_ValueForKey(info, "ping"));
-			if (ping == -1)
-			{
-				// if we ever see a ping that is out of date, do a server refresh
-				// UI_UpdatePendingPings();
-			}
+			uiServerInfo_t *server;
+
+			server = &uiInfo.serverStatus.serverInfo[uiInfo.serverStatus.displayServers[index]];
 			switch (column)
 			{
 				case SORT_HOST :
-					if (ping <= 0)
+					if (server->ping <= 0)
 					{
+						trap_LAN_GetServerInfo(ui_netSource.integer, uiInfo.serverStatus.displayServers[index], info, MAX_STRING_CHARS);
 						return Info_ValueForKey(info, "addr");
 					}
 					else
@@ -5125,37 +5297,36 @@ static const char *UI_FeederItemText(float feederID, int index, int column, qhan
 						if (ui_netSource.integer == AS_LOCAL)
 						{
 							Com_sprintf(hostname, sizeof(hostname), "%s [%s]",
-											Info_ValueForKey(info, "hostname"),
-											netnames[atoi(Info_ValueForKey(info, "nettype"))]);
+											server->hostName, netnames[server->netType]);
 							return hostname;
 						}
 						else
 						{
-							return Info_ValueForKey(info, "hostname");
+							return server->hostName;
 						}
 					}
-				case SORT_MAP : return Info_ValueForKey(info, "mapname");
+				case SORT_MAP : return server->mapName;
 				case SORT_CLIENTS :
-					Com_sprintf(clientBuff, sizeof(clientBuff), "%s (%s)", Info_ValueForKey(info, "clients"), Info_ValueForKey(info, "sv_maxclients"));
+					Com_sprintf(clientBuff, sizeof(clientBuff), "%i (%i)", server->clients, server->maxClients);
 					return clientBuff;
 				case SORT_GAME :
-					game = atoi(Info_ValueForKey(info, "gametype"));
-					if (game >= 0 && game < numTeamArenaGameTypes)
+					if (server->gameType >= 0 && server->gameType < numTeamArenaGameTypes)
 					{
-						return teamArenaGameTypes[game];
+						return teamArenaGameTypes[server->gameType];
 					}
 					else
 					{
 						return "Unknown";
 					}
 				case SORT_PING :
-					if (ping <= 0)
+					if (server->ping <= 0)
 					{
 						return "...";
 					}
 					else
 					{
-						return Info_ValueForKey(info, "ping");
+						Com_sprintf(clientBuff, sizeof(clientBuff), "%i", server->ping);
+						return clientBuff;
 					}
 			}
 		}
@@ -6695,6 +6866,7 @@ vmCvar_t	ui_recordSPDemo;
 vmCvar_t	ui_realCaptureLimit;
 vmCvar_t	ui_realWarmUp;
 vmCvar_t	ui_serverStatusTimeOut;
+vmCvar_t	ui_menuCache;
 
 
 cvarTable_t		cvarTable[] =
@@ -6817,6 +6989,7 @@ cvarTable_t		cvarTable[] =
 	{ &ui_realWarmUp, "g_warmup", "20", CVAR_ARCHIVE},
 	{ &ui_realCaptureLimit, "capturelimit", "8", CVAR_SERVERINFO | CVAR_ARCHIVE | CVAR_NORESTART},
 	{ &ui_serverStatusTimeOut, "ui_serverStatusTimeOut", "7000", CVAR_ARCHIVE},
+	{ &ui_menuCache, "ui_menuCache", "1", CVAR_ARCHIVE},
 
 };
 
@@ -6979,8 +7152,7 @@ static void UI_StartServerRefresh(qboolean full)
 	uiInfo.serverStatus.refreshActive = qtrue;
 	uiInfo.serverStatus.nextDisplayRefresh = uiInfo.uiDC.realTime + 1000;
 	// clear number of displayed servers
-	uiInfo.serverStatus.numDisplayServers = 0;
-	uiInfo.serverStatus.numPlayersOnServers = 0;
+	UI_ClearServerDisplayList();
 	// mark all servers as visible so we store ping updates for them
 	trap_LAN_MarkServerVisible(ui_netSource.integer, -1, qtrue);
 	// reset all the pings
@@ -55,6 +55,16 @@ itemDef_t *Menu_SetPrevCursorItem(menuDef_t *menu);
 itemDef_t *Menu_SetNextCursorItem(menuDef_t *menu);
 static qboolean Menu_OverActiveItem(menuDef_t *menu, float x, float y);
 
+typedef enum
+{
+	CACHEASSET_SHADER,
+	CACHEASSET_MODEL,
+	CACHEASSET_SOUND
+}
+cacheAssetType_t;
+
+static void MenuCache_RegisterAsset(cacheAssetType_t type, const char *name, int *handle);
+
 #ifdef CGAME
 #define MEM_POOL_SIZE  128 * 1024
 #else
@@ -112,50 +122,76 @@ qboolean UI_OutOfMemory()
 
 
 
-#define HASH_TABLE_SIZE 2048
 /*
 ================
-return a hash value for the string
+String table
+
+Interned strings are kept in an open addressing table with linear
+probing. It is sized from the string pool: twice as many slots as
+the pool holds strings of STRING_AVERAGE_LEN bytes, so lookups stay
+short. A slot keeps the full hash and the length of its string,
+most mismatches never touch the string pool.
+
+Should the table still fill up past STRING_HASH_LOAD, strings keep
+going into the pool without a slot, they just aren't shared.
 ================
 */
-static long hashForString(const char *str)
-{
-	int		i;
-	long	hash;
-	char	letter;
+#define STRING_AVERAGE_LEN	24
 
-	hash = 0;
-	i = 0;
-	while (str[i] != '\0')
-	{
-		letter = tolower(str[i]);
-		hash+=(long)(letter)*(i+119);
-		i++;
-	}
-	hash &= (HASH_TABLE_SIZE-1);
-	return hash;
-}
+#ifdef CGAME
+#define STRING_HASH_SIZE	16384		// >= 2 * 128k / STRING_AVERAGE_LEN, a power of two
+#else
+#define STRING_HASH_SIZE	32768		// >= 2 * 384k / STRING_AVERAGE_LEN, a power of two
+#endif
+#define STRING_HASH_LOAD	(STRING_HASH_SIZE * 3 / 4)
 
-typedef struct stringDef_s
+typedef struct
 {
-	struct stringDef_s *next;
-	const char *str;
+	const char	*str;			// NULL for a free slot
+	int			hash;
+	int			len;
 }
-stringDef_t;
+stringSlot_t;
 
 static int strPoolIndex = 0;
 static char strPool[STRING_POOL_SIZE];
+static const char *staticNULL = "";
 
 static int strHandleCount = 0;
-static stringDef_t *strHandle[HASH_TABLE_SIZE];
+static stringSlot_t strSlots[STRING_HASH_SIZE];
+static qboolean strTableFull = qfalse;
+
+// statistics for String_Report
+static int strLookups = 0;
+static int strHits = 0;
+static int strProbes = 0;
+
+/*
+================
+String_Hash
 
+FNV-1a
+================
+*/
+static int String_Hash(const char *str, int *len)
+{
+	const unsigned char	*s;
+	unsigned int		hash;
+
+	hash = 2166136261U;
+	for (s = (const unsigned char *)str; *s; s++)
+	{
+		hash ^= *s;
+		hash *= 16777619U;
+	}
+	*len = (const char *)s - str;
+	return (int)hash;
+}
 
 const char *String_Alloc(const char *p)
 {
-	int len;
-	long hash;
-	stringDef_t *str, *last;
-	static const char *staticNULL = "";
+	int len, hash, i;
+	stringSlot_t *slot;
 
 	if (p == NULL)
 	{
@@ -167,47 +203,50 @@ const char *String_Alloc(const char *p)
 		return staticNULL;
 	}
 
-	hash = hashForString(p);
+	strLookups++;
+	hash = String_Hash(p, &len);
 
-	str = strHandle[hash];
-	while (str)
+	for (i = hash & (STRING_HASH_SIZE-1); ; i = (i + 1) & (STRING_HASH_SIZE-1))
 	{
-		if (strcmp(p, str->str) == 0)
+		slot = &strSlots[i];
+		if (!slot->str)
+		{
+			break;
+		}
+		if (slot->hash == hash && slot->len == len && !strcmp(slot->str, p))
 		{
-			return str->str;
+			strHits++;
+			return slot->str;
 		}
-		str = str->next;
+		strProbes++;
 	}
 
-	len = strlen(p);
-	if (len + strPoolIndex + 1 < STRING_POOL_SIZE)
+	if (len + strPoolIndex + 1 >= STRING_POOL_SIZE)
 	{
-		int ph = strPoolIndex;
-		strcpy(&strPool[strPoolIndex], p);
-		strPoolIndex += len + 1;
+		return NULL;
+	}
 
-		str = strHandle[hash];
-		last = str;
-		while (str && str->next)
-		{
-			last = str;
-			str = str->next;
-		}
+	memcpy(&strPool[strPoolIndex], p, len + 1);
+	p = &strPool[strPoolIndex];
+	strPoolIndex += len + 1;
 
-		str  = UI_Alloc(sizeof(stringDef_t));
-		str->next = NULL;
-		str->str = &strPool[ph];
-		if (last)
-		{
-			last->next = str;
-		}
-		else
+	if (strHandleCount >= STRING_HASH_LOAD)
+	{
+		if (!strTableFull)
 		{
-			strHandle[hash] = str;
+			Com_Printf(S_COLOR_YELLOW "WARNING: String table is full, strings are no longer shared\n");
+			strTableFull = qtrue;
 		}
-		return &strPool[ph];
+		return p;
 	}
-	return NULL;
+
+	// slot is the free one ending the probe sequence
+	slot->str = p;
+	slot->hash = hash;
+	slot->len = len;
+	strHandleCount++;
+
+	return slot->str;
 }
 
 void String_Report()
@@ -219,6 +258,16 @@ void String_Report()
 	f /= STRING_POOL_SIZE;
 	f *= 100;
 	Com_Printf("String Pool is %.1f%% full, %i bytes out of %i used.\n", f, strPoolIndex, STRING_POOL_SIZE);
+	f = strHandleCount;
+	f /= STRING_HASH_SIZE;
+	f *= 100;
+	Com_Printf("String Table has %i strings in %i slots (%.1f%% load), %i bytes.\n",
+					strHandleCount, STRING_HASH_SIZE, f, (int)sizeof(strSlots));
+	if (strLookups)
+	{
+		Com_Printf("String Table had %i lookups, %i%% already interned, %.2f extra probes per lookup.\n",
+						strLookups, strHits * 100 / strLookups, (float)strProbes / strLookups);
+	}
 	f = allocPoint;
 	f /= MEM_POOL_SIZE;
 	f *= 100;
@@ -232,13 +281,13 @@ String_Init
 */
 void String_Init()
 {
-	int i;
-	for (i = 0; i < HASH_TABLE_SIZE; i++)
-	{
-		strHandle[i] = 0;
-	}
+	memset(strSlots, 0, sizeof(strSlots));
 	strHandleCount = 0;
+	strTableFull = qfalse;
 	strPoolIndex = 0;
+	strLookups = 0;
+	strHits = 0;
+	strProbes = 0;
 	menuCount = 0;
 	openMenuCount = 0;
 	UI_InitMemory();
@@ -5244,7 +5293,7 @@ qboolean ItemParse_focusSound( itemDef_t *item, int handle )
 	{
 		return qfalse;
 	}
-	item->focusSound = DC->registerSound(temp, qfalse);
+	MenuCache_RegisterAsset(CACHEASSET_SOUND, temp, &item->focusSound);
 	return qtrue;
 }
 
@@ -5281,7 +5330,7 @@ qboolean ItemParse_asset_model( itemDef_t *item, int handle )
 	{
 		return qfalse;
 	}
-	item->asset = DC->registerModel(temp);
+	MenuCache_RegisterAsset(CACHEASSET_MODEL, temp, &item->asset);
 	modelPtr->angle = rand() % 360;
 	return qtrue;
 }
@@ -5295,7 +5344,7 @@ qboolean ItemParse_asset_shader( itemDef_t *item, int handle )
 	{
 		return qfalse;
 	}
-	item->asset = DC->registerShaderNoMip(temp);
+	MenuCache_RegisterAsset(CACHEASSET_SHADER, temp, &item->asset);
 	return qtrue;
 }
 
@@ -5707,7 +5756,7 @@ qboolean ItemParse_background( itemDef_t *item, int handle )
 	{
 		return qfalse;
 	}
-	item->window.background = DC->registerShaderNoMip(temp);
+	MenuCache_RegisterAsset(CACHEASSET_SHADER, temp, &item->window.background);
 	return qtrue;
 }
 
@@ -6471,7 +6520,7 @@ qboolean MenuParse_background( itemDef_t *item, int handle )
 	{
 		return qfalse;
 	}
-	menu->window.background = DC->registerShaderNoMip(buff);
+	MenuCache_RegisterAsset(CACHEASSET_SHADER, buff, &menu->window.background);
 	return qtrue;
 }
 
@@ -6738,6 +6787,890 @@ void Menu_Reset()
 	menuCount = 0;
 }
 
+/*
+===============
+Menu cache
+
+A parsed menu file is saved as a binary image of the menus it added
+and its slice of the memory pool, so the next load is a few reads
+instead of a pass through the precompiler. Every pointer in the
+image is stored as an offset: strings into a string table saved
+with the image, items and type data into the pool slice and item
+parents into the menus. Asset handles don't survive a restart, they
+are saved by name and registered again on load. The image is keyed
+on the source text, an edited menu file just gets parsed again.
+
+An assetGlobalDef block is handled by the module, not by Menu_Parse,
+so it is copied out to a small text file that is parsed as usual,
+before the menus of the image are added, as it comes first in the
+source.
+===============
+*/
+#define MENUCACHE_IDENT		(('C'<<24)+('M'<<16)+('I'<<8)+'U')
+#define MENUCACHE_VERSION	1
+
+#define MAX_CACHE_ASSETS	512
+#define MAX_CACHE_STRINGS	4096		// must be a power of two
+#define CACHE_STRING_SIZE	(64*1024)
+
+#define MENUCACHE_NOWHERE	0x7fffffff
+
+#ifdef CGAME
+#define MENUCACHE_DIR		"menucache/cgame"
+#else
+#define MENUCACHE_DIR		"menucache/ui"
+#endif
+
+typedef enum
+{
+	CACHE_CHECK,					// validate pointers and build the string table
+	CACHE_SAVE,						// pointers to offsets
+	CACHE_LOAD						// offsets to pointers
+}
+cacheMode_t;
+
+typedef struct
+{
+	int			type;				// cacheAssetType_t
+	const char	*name;				// interned
+	int			*handle;
+}
+cacheAsset_t;
+
+typedef struct
+{
+	int			type;
+	int			name;				// string table offset + 1
+	int			location;			// >= 0 pool slice offset, < 0 -1 - menus offset
+}
+cacheAssetRecord_t;
+
+typedef struct
+{
+	int			ident;
+	int			version;
+	int			key;				// hash of the source text
+	int			pointerSize;		// images only load into the same build
+	int			menuSize;
+	int			itemSize;
+	int			menuCount;
+	int			poolSize;
+	int			stringSize;
+	int			assetCount;
+	qboolean	hasAssetDef;
+}
+menuCacheHeader_t;
+
+static cacheMode_t	cacheMode;
+static menuDef_t	*cacheMenus;		// first menu of the file
+static int			cacheMenuCount;
+static char			*cachePool;			// pool slice of the file
+static int			cachePoolSize;
+
+static char			cacheStrings[CACHE_STRING_SIZE];
+static int			cacheStringSize;
+static int			cacheStringCount;
+static int			cacheStringKeys[MAX_CACHE_STRINGS];		// string pool offset + 1, 0 is free
+static int			cacheStringOffsets[MAX_CACHE_STRINGS];
+
+static qboolean		cacheRecording = qfalse;
+static qboolean		cacheOverflow;
+static int			cacheFirstMenu;
+static int			cachePoolStart;
+static float		cacheFadeAmount;	// the global fade settings before the parse
+static float		cacheFadeClamp;
+static int			cacheFadeCycle;
+static int			cacheAssetCount;
+static cacheAsset_t	cacheAssets[MAX_CACHE_ASSETS];
+static cacheAssetRecord_t	cacheAssetRecords[MAX_CACHE_ASSETS];
+
+static int MenuCache_Register(int type, const char *name)
+{
+	switch (type)
+	{
+		case CACHEASSET_SHADER:
+			return DC->registerShaderNoMip(name);
+		case CACHEASSET_MODEL:
+			return DC->registerModel(name);
+		case CACHEASSET_SOUND:
+			return DC->registerSound(name, qfalse);
+	}
+	return 0;
+}
+
+/*
+=================
+MenuCache_RegisterAsset
+
+Registers an asset for a menu keyword and remembers it by name while
+a menu file is being compiled.
+=================
+*/
+static void MenuCache_RegisterAsset(cacheAssetType_t type, const char *name, int *handle)
+{
+	*handle = MenuCache_Register(type, name);
+
+	if (!cacheRecording)
+	{
+		return;
+	}
+	if (cacheAssetCount >= MAX_CACHE_ASSETS)
+	{
+		cacheOverflow = qtrue;
+		return;
+	}
+	cacheAssets[cacheAssetCount].type = type;
+	cacheAssets[cacheAssetCount].name = name;
+	cacheAssets[cacheAssetCount].handle = handle;
+	cacheAssetCount++;
+}
+
+/*
+=================
+MenuCache_String
+
+Strings are saved by value, the one table per image holds each of
+them once and loading interns them again.
+=================
+*/
+static qboolean MenuCache_String(const char **p)
+{
+	const char	*s = *p;
+	int			key, len, i;
+
+	if (!s)
+	{
+		return qtrue;
+	}
+
+	if (cacheMode == CACHE_LOAD)
+	{
+		i = (int)(long)s - 1;
+		if (i < 0 || i >= cacheStringSize)
+		{
+			return qfalse;
+		}
+		*p = String_Alloc(&cacheStrings[i]);
+		return *p != NULL;
+	}
+
+	// interned strings are unique, their pool offset is a good key
+	if (s == staticNULL)
+	{
+		key = STRING_POOL_SIZE + 1;
+	}
+	else if (s >= strPool && s < &strPool[strPoolIndex])
+	{
+		key = s - strPool + 1;
+	}
+	else
+	{
+		return qfalse;
+	}
+
+	for (i = (key * 2654435761U) & (MAX_CACHE_STRINGS-1); cacheStringKeys[i]; i = (i + 1) & (MAX_CACHE_STRINGS-1))
+	{
+		if (cacheStringKeys[i] == key)
+		{
+			break;
+		}
+	}
+
+	if (!cacheStringKeys[i])
+	{
+		// only a check pass adds strings, so a save pass can't fail half way
+		len = strlen(s) + 1;
+		if (cacheMode != CACHE_CHECK || cacheStringSize + len > CACHE_STRING_SIZE)
+		{
+			return qfalse;
+		}
+		cacheStringKeys[i] = key;
+		cacheStringOffsets[i] = cacheStringSize;
+		memcpy(&cacheStrings[cacheStringSize], s, len);
+		cacheStringSize += len;
+		// keep a free slot to end the probe sequences
+		if (++cacheStringCount >= MAX_CACHE_STRINGS - 1)
+		{
+			return qfalse;
+		}
+	}
+
+	if (cacheMode == CACHE_SAVE)
+	{
+		*p = (const char *)(long)(cacheStringOffsets[i] + 1);
+	}
+	return qtrue;
+}
+
+/*
+=================
+MenuCache_Pointer
+
+Pointers into a block, the pool slice or the menus, with room for
+at least size bytes behind them.
+=================
+*/
+static qboolean MenuCache_Pointer(void **p, char *base, int blockSize, int size)
+{
+	int ofs;
+
+	if (!*p)
+	{
+		return qtrue;
+	}
+
+	if (cacheMode == CACHE_LOAD)
+	{
+		ofs = (int)(long)*p - 1;
+	}
+	else
+	{
+		ofs = (char *)*p - base;
+	}
+
+	if (ofs < 0 || ofs + size > blockSize)
+	{
+		return qfalse;
+	}
+
+	if (cacheMode == CACHE_LOAD)
+	{
+		*p = base + ofs;
+	}
+	else if (cacheMode == CACHE_SAVE)
+	{
+		*p = (void *)(long)(ofs + 1);
+	}
+	return qtrue;
+}
+
+static qboolean MenuCache_Window(windowDef_t *w)
+{
+	return MenuCache_String(&w->name)
+		&& MenuCache_String(&w->group)
+		&& MenuCache_String(&w->cinematicName);
+}
+
+static qboolean MenuCache_TypeData(itemDef_t *item)
+{
+	listBoxDef_t	*listPtr;
+	multiDef_t		*multiPtr;
+	int				i, size;
+
+	// only list boxes and multis hold pointers
+	size = 1;
+	if (item->type == ITEM_TYPE_LISTBOX)
+	{
+		size = sizeof(listBoxDef_t);
+	}
+	else if (item->type == ITEM_TYPE_MULTI)
+	{
+		size = sizeof(multiDef_t);
+	}
+
+	// a save pass still needs the pointer to walk the data
+	if (cacheMode != CACHE_SAVE && !MenuCache_Pointer(&item->typeData, cachePool, cachePoolSize, size))
+	{
+		return qfalse;
+	}
+
+	if (item->typeData)
+	{
+		if (item->type == ITEM_TYPE_LISTBOX)
+		{
+			listPtr = (listBoxDef_t*)item->typeData;
+			if (!MenuCache_String(&listPtr->doubleClick))
+			{
+				return qfalse;
+			}
+		}
+		else if (item->type == ITEM_TYPE_MULTI)
+		{
+			multiPtr = (multiDef_t*)item->typeData;
+			if (multiPtr->count < 0 || multiPtr->count > MAX_MULTI_CVARS)
+			{
+				return qfalse;
+			}
+			for (i = 0; i < multiPtr->count; i++)
+			{
+				if (!MenuCache_String(&multiPtr->cvarList[i]) || !MenuCache_String(&multiPtr->cvarStr[i]))
+				{
+					return qfalse;
+				}
+			}
+		}
+	}
+
+	if (cacheMode == CACHE_SAVE && !MenuCache_Pointer(&item->typeData, cachePool, cachePoolSize, size))
+	{
+		return qfalse;
+	}
+	return qtrue;
+}
+
+static qboolean MenuCache_Item(itemDef_t *item)
+{
+	return MenuCache_Window(&item->window)
+		&& MenuCache_String(&item->text)
+		&& MenuCache_String(&item->mouseEnterText)
+		&& MenuCache_String(&item->mouseExitText)
+		&& MenuCache_String(&item->mouseEnter)
+		&& MenuCache_String(&item->mouseExit)
+		&& MenuCache_String(&item->action)
+		&& MenuCache_String(&item->onFocus)
+		&& MenuCache_String(&item->leaveFocus)
+		&& MenuCache_String(&item->cvar)
+		&& MenuCache_String(&item->cvarTest)
+		&& MenuCache_String(&item->enableCvar)
+		&& MenuCache_Pointer(&item->parent, (char *)cacheMenus, cacheMenuCount * sizeof(menuDef_t), sizeof(menuDef_t))
+		&& MenuCache_TypeData(item);
+}
+
+static qboolean MenuCache_Menu(menuDef_t *menu)
+{
+	int i;
+
+	if (!MenuCache_Window(&menu->window)
+		|| !MenuCache_String(&menu->font)
+		|| !MenuCache_String(&menu->onOpen)
+		|| !MenuCache_String(&menu->onClose)
+		|| !MenuCache_String(&menu->onESC)
+		|| !MenuCache_String(&menu->soundName))
+	{
+		return qfalse;
+	}
+
+	if (menu->itemCount < 0 || menu->itemCount > MAX_MENUITEMS)
+	{
+		return qfalse;
+	}
+
+	for (i = 0; i < menu->itemCount; i++)
+	{
+		if (cacheMode != CACHE_SAVE)
+		{
+			if (!MenuCache_Pointer((void **)&menu->items[i], cachePool, cachePoolSize, sizeof(itemDef_t)) || !menu->items[i])
+			{
+				return qfalse;
+			}
+		}
+		if (!MenuCache_Item(menu->items[i]))
+		{
+			return qfalse;
+		}
+		if (cacheMode == CACHE_SAVE)
+		{
+			MenuCache_Pointer((void **)&menu->items[i], cachePool, cachePoolSize, sizeof(itemDef_t));
+		}
+	}
+	return qtrue;
+}
+
+static qboolean MenuCache_Relocate(cacheMode_t mode)
+{
+	int i;
+
+	cacheMode = mode;
+	for (i = 0; i < cacheMenuCount; i++)
+	{
+		if (!MenuCache_Menu(&cacheMenus[i]))
+		{
+			return qfalse;
+		}
+	}
+	return qtrue;
+}
+
+/*
+=================
+MenuCache_AssetLocation
+
+Where an asset handle lives, in the pool slice or in the menus.
+=================
+*/
+static int MenuCache_AssetLocation(int *handle)
+{
+	int ofs;
+
+	ofs = (char *)handle - cachePool;
+	if (ofs >= 0 && ofs + (int)sizeof(int) <= cachePoolSize)
+	{
+		return ofs;
+	}
+	ofs = (char *)handle - (char *)cacheMenus;
+	if (ofs >= 0 && ofs + (int)sizeof(int) <= cacheMenuCount * (int)sizeof(menuDef_t))
+	{
+		return -1 - ofs;
+	}
+	// a menu that failed to parse
+	return MENUCACHE_NOWHERE;
+}
+
+static int *MenuCache_AssetHandle(int location)
+{
+	if (location >= 0)
+	{
+		if (location + (int)sizeof(int) > cachePoolSize)
+		{
+			return NULL;
+		}
+		return (int *)(cachePool + location);
+	}
+	location = -1 - location;
+	if (location + (int)sizeof(int) > cacheMenuCount * (int)sizeof(menuDef_t))
+	{
+		return NULL;
+	}
+	return (int *)((char *)cacheMenus + location);
+}
+
+static qboolean MenuCache_HashFile(const char *name, unsigned int *hash)
+{
+	static char		buf[4096];
+	fileHandle_t	f;
+	int				len, n, i;
+
+	len = trap_FS_FOpenFile(name, &f, FS_READ);
+	if (!f)
+	{
+		return qfalse;
+	}
+
+	*hash = (*hash ^ len) * 16777619U;
+	while (len > 0)
+	{
+		n = len < sizeof(buf) ? len : sizeof(buf);
+		trap_FS_Read(buf, n, f);
+		for (i = 0; i < n; i++)
+		{
+			*hash = (*hash ^ (unsigned char)buf[i]) * 16777619U;
+		}
+		len -= n;
+	}
+	trap_FS_FCloseFile(f);
+	return qtrue;
+}
+
+/*
+=================
+MenuCache_Key
+
+Menus are initialized with the global fade settings, those go into the
+key along with the source and the shared definitions it includes. They
+are the settings from before the file is parsed, the file's own
+assetGlobalDef sets them again on every load.
+=================
+*/
+static qboolean MenuCache_Key(const char *menuFile, float fadeAmount, float fadeClamp, int fadeCycle, int *key)
+{
+	unsigned int hash;
+
+	hash = 2166136261U;
+	if (!MenuCache_HashFile(menuFile, &hash))
+	{
+		return qfalse;
+	}
+	MenuCache_HashFile("ui/menudef.h", &hash);
+	hash = (hash ^ (int)(fadeAmount * 1000)) * 16777619U;
+	hash = (hash ^ (int)(fadeClamp * 1000)) * 16777619U;
+	hash = (hash ^ fadeCycle) * 16777619U;
+	*key = (int)hash;
+	return qtrue;
+}
+
+static void MenuCache_Path(const char *menuFile, const char *ext, char *path, int size)
+{
+	Com_sprintf(path, size, "%s/%s.%s", MENUCACHE_DIR, menuFile, ext);
+}
+
+static void MenuCache_WriteToken(fileHandle_t f, pc_token_t *token)
+{
+	const char *s;
+
+	if (token->type == TT_STRING)
+	{
+		s = va("\"%s\" ", token->string);
+	}
+	else if (token->string[0] == '{' || token->string[0] == '}')
+	{
+		s = va("%s\n", token->string);
+	}
+	else
+	{
+		s = va("%s ", token->string);
+	}
+	trap_FS_Write(s, strlen(s), f);
+}
+
+/*
+=================
+MenuCache_SkipBlock
+
+Reads a { } block, copying its tokens to f if it is set, the way the
+module menu parsers would see them.
+=================
+*/
+static qboolean MenuCache_SkipBlock(int handle, fileHandle_t f)
+{
+	pc_token_t	token;
+	int			depth;
+
+	depth = 0;
+	do
+	{
+		if (!trap_PC_ReadToken(handle, &token))
+		{
+			return qfalse;
+		}
+		if (!depth && (token.type == TT_STRING || token.string[0] != '{'))
+		{
+			return qfalse;
+		}
+		if (token.type == TT_STRING)
+		{
+			// no way to write these back
+			if (strchr(token.string, '"') || strchr(token.string, '\n'))
+			{
+				return qfalse;
+			}
+		}
+		else if (token.string[0] == '{')
+		{
+			depth++;
+		}
+		else if (token.string[0] == '}')
+		{
+			depth--;
+		}
+		if (f)
+		{
+			MenuCache_WriteToken(f, &token);
+		}
+	}
+	while (depth > 0);
+
+	return qtrue;
+}
+
+/*
+=================
+MenuCache_WriteAssetDef
+
+Copies the assetGlobalDef blocks of a menu file into a text file of
+their own. Returns qfalse if they can't be written back as text.
+=================
+*/
+static qboolean MenuCache_WriteAssetDef(const char *menuFile, const char *assetFile, qboolean *hasAssetDef)
+{
+	pc_token_t		token;
+	fileHandle_t	f;
+	int				handle;
+	qboolean		ok;
+
+	*hasAssetDef = qfalse;
+	handle = trap_PC_LoadSource(menuFile);
+	if (!handle)
+	{
+		return qfalse;
+	}
+
+	f = 0;
+	ok = qtrue;
+	while (trap_PC_ReadToken(handle, &token))
+	{
+		if (token.string[0] == '}')
+		{
+			break;
+		}
+
+		if (Q_stricmp(token.string, "assetGlobalDef") == 0)
+		{
+			if (!f)
+			{
+				trap_FS_FOpenFile(assetFile, &f, FS_WRITE);
+				if (!f)
+				{
+					ok = qfalse;
+					break;
+				}
+				*hasAssetDef = qtrue;
+			}
+			MenuCache_WriteToken(f, &token);
+			if (!MenuCache_SkipBlock(handle, f))
+			{
+				ok = qfalse;
+				break;
+			}
+			continue;
+		}
+
+		if (Q_stricmp(token.string, "menudef") == 0)
+		{
+			if (!MenuCache_SkipBlock(handle, 0))
+			{
+				ok = qfalse;
+				break;
+			}
+		}
+	}
+
+	if (f)
+	{
+		trap_FS_FCloseFile(f);
+	}
+	trap_PC_FreeSource(handle);
+	return ok;
+}
+
+/*
+=================
+MenuCache_Begin
+
+Starts recording what a menu file adds, call before parsing it.
+=================
+*/
+void MenuCache_Begin(void)
+{
+	cacheRecording = qtrue;
+	cacheOverflow = qfalse;
+	cacheFirstMenu = menuCount;
+	cachePoolStart = allocPoint;
+	cacheAssetCount = 0;
+	cacheFadeAmount = DC->Assets.fadeAmount;
+	cacheFadeClamp = DC->Assets.fadeClamp;
+	cacheFadeCycle = DC->Assets.fadeCycle;
+}
+
+/*
+=================
+MenuCache_End
+
+Saves what the menu file parsed since MenuCache_Begin.
+=================
+*/
+void MenuCache_End(const char *menuFile)
+{
+	menuCacheHeader_t	header;
+	fileHandle_t		f;
+	char				path[MAX_QPATH];
+	char				assetPath[MAX_QPATH];
+	const char			*name;
+	int					i, location;
+
+	if (!cacheRecording)
+	{
+		return;
+	}
+	cacheRecording = qfalse;
+
+	if (outOfMemory || cacheOverflow
+		|| !MenuCache_Key(menuFile, cacheFadeAmount, cacheFadeClamp, cacheFadeCycle, &header.key))
+	{
+		return;
+	}
+
+	cacheMenus = &Menus[cacheFirstMenu];
+	cacheMenuCount = menuCount - cacheFirstMenu;
+	cachePool = &memoryPool[cachePoolStart];
+	cachePoolSize = allocPoint - cachePoolStart;
+	cacheStringSize = 0;
+	cacheStringCount = 0;
+	memset(cacheStringKeys, 0, sizeof(cacheStringKeys));
+
+	// nothing is touched until everything is known to fit
+	if (!MenuCache_Relocate(CACHE_CHECK))
+	{
+		DC->Print(S_COLOR_YELLOW "WARNING: can't cache menu file %s\n", menuFile);
+		return;
+	}
+
+	header.assetCount = 0;
+	for (i = 0; i < cacheAssetCount; i++)
+	{
+		location = MenuCache_AssetLocation(cacheAssets[i].handle);
+		if (location == MENUCACHE_NOWHERE)
+		{
+			continue;
+		}
+		name = cacheAssets[i].name;
+		if (!MenuCache_String(&name))
+		{
+			DC->Print(S_COLOR_YELLOW "WARNING: can't cache menu file %s\n", menuFile);
+			return;
+		}
+		cacheAssetRecords[header.assetCount].type = cacheAssets[i].type;
+		cacheAssetRecords[header.assetCount].location = location;
+		header.assetCount++;
+	}
+
+	MenuCache_Path(menuFile, "assets", assetPath, sizeof(assetPath));
+	if (!MenuCache_WriteAssetDef(menuFile, assetPath, &header.hasAssetDef))
+	{
+		DC->Print(S_COLOR_YELLOW "WARNING: can't cache menu file %s\n", menuFile);
+		return;
+	}
+
+	MenuCache_Path(menuFile, "bin", path, sizeof(path));
+	trap_FS_FOpenFile(path, &f, FS_WRITE);
+	if (!f)
+	{
+		return;
+	}
+
+	header.ident = MENUCACHE_IDENT;
+	header.version = MENUCACHE_VERSION;
+	header.pointerSize = sizeof(void *);
+	header.menuSize = sizeof(menuDef_t);
+	header.itemSize = sizeof(itemDef_t);
+	header.menuCount = cacheMenuCount;
+	header.poolSize = cachePoolSize;
+
+	// the asset names are in the table now, save their offsets
+	cacheMode = CACHE_SAVE;
+	for (i = 0, location = 0; i < cacheAssetCount; i++)
+	{
+		if (MenuCache_AssetLocation(cacheAssets[i].handle) == MENUCACHE_NOWHERE)
+		{
+			continue;
+		}
+		name = cacheAssets[i].name;
+		MenuCache_String(&name);
+		cacheAssetRecords[location++].name = (int)(long)name;
+	}
+
+	MenuCache_Relocate(CACHE_SAVE);
+	header.stringSize = cacheStringSize;
+
+	trap_FS_Write(&header, sizeof(header), f);
+	trap_FS_Write(cacheMenus, cacheMenuCount * sizeof(menuDef_t), f);
+	trap_FS_Write(cachePool, cachePoolSize, f);
+	trap_FS_Write(cacheStrings, cacheStringSize, f);
+	trap_FS_Write(cacheAssetRecords, header.assetCount * sizeof(cacheAssetRecord_t), f);
+	trap_FS_FCloseFile(f);
+
+	// back to live pointers, the strings intern to what they were
+	MenuCache_Relocate(CACHE_LOAD);
+}
+
+/*
+=================
+MenuCache_Load
+
+Adds the menus of a menu file from its cache. Returns qfalse if there
+is no cache or it is out of date, the file has to be parsed then.
+parseAssets is given the text file of the assetGlobalDef, if the file
+has one, once the image is known to be good and before its menus are
+added, the order the source has them in.
+=================
+*/
+qboolean MenuCache_Load(const char *menuFile, void (*parseAssets)(const char *assetFile))
+{
+	menuCacheHeader_t	header;
+	fileHandle_t		f;
+	char				path[MAX_QPATH];
+	const char			*name;
+	int					*handle;
+	int					key, len, poolStart, i;
+
+	if (!MenuCache_Key(menuFile, DC->Assets.fadeAmount, DC->Assets.fadeClamp, DC->Assets.fadeCycle, &key))
+	{
+		return qfalse;
+	}
+
+	MenuCache_Path(menuFile, "bin", path, sizeof(path));
+	len = trap_FS_FOpenFile(path, &f, FS_READ);
+	if (!f)
+	{
+		return qfalse;
+	}
+
+	if (len < sizeof(header))
+	{
+		trap_FS_FCloseFile(f);
+		return qfalse;
+	}
+	trap_FS_Read(&header, sizeof(header), f);
+
+	if (header.ident != MENUCACHE_IDENT || header.version != MENUCACHE_VERSION || header.key != key
+		|| header.pointerSize != sizeof(void *) || header.menuSize != sizeof(menuDef_t) || header.itemSize != sizeof(itemDef_t)
+		|| header.menuCount < 0 || menuCount + header.menuCount > MAX_MENUS
+		|| header.poolSize < 0 || allocPoint + header.poolSize > MEM_POOL_SIZE
+		|| header.stringSize < 0 || header.stringSize > CACHE_STRING_SIZE
+		|| header.assetCount < 0 || header.assetCount > MAX_CACHE_ASSETS
+		|| len != sizeof(header) + header.menuCount * sizeof(menuDef_t) + header.poolSize
+					+ header.stringSize + header.assetCount * sizeof(cacheAssetRecord_t))
+	{
+		trap_FS_FCloseFile(f);
+		return qfalse;
+	}
+
+	poolStart = allocPoint;
+	cacheMenus = &Menus[menuCount];
+	cacheMenuCount = header.menuCount;
+	cachePool = &memoryPool[allocPoint];
+	cachePoolSize = header.poolSize;
+	cacheStringSize = header.stringSize;
+	if (cachePoolSize)
+	{
+		UI_Alloc(cachePoolSize);
+	}
+
+	trap_FS_Read(cacheMenus, cacheMenuCount * sizeof(menuDef_t), f);
+	trap_FS_Read(cachePool, cachePoolSize, f);
+	trap_FS_Read(cacheStrings, cacheStringSize, f);
+	trap_FS_Read(cacheAssetRecords, header.assetCount * sizeof(cacheAssetRecord_t), f);
+	trap_FS_FCloseFile(f);
+
+	if (cacheStringSize && cacheStrings[cacheStringSize - 1])
+	{
+		allocPoint = poolStart;
+		return qfalse;
+	}
+
+	if (!MenuCache_Relocate(CACHE_LOAD))
+	{
+		allocPoint = poolStart;
+		return qfalse;
+	}
+
+	// every record has to resolve before any handle is written
+	for (i = 0; i < header.assetCount; i++)
+	{
+		name = (const char *)(long)cacheAssetRecords[i].name;
+		if (!name || !MenuCache_String(&name) || !MenuCache_AssetHandle(cacheAssetRecords[i].location))
+		{
+			allocPoint = poolStart;
+			return qfalse;
+		}
+	}
+	for (i = 0; i < header.assetCount; i++)
+	{
+		name = (const char *)(long)cacheAssetRecords[i].name;
+		MenuCache_String(&name);
+		handle = MenuCache_AssetHandle(cacheAssetRecords[i].location);
+		*handle = MenuCache_Register(cacheAssetRecords[i].type, name);
+	}
+
+	if (header.hasAssetDef)
+	{
+		MenuCache_Path(menuFile, "assets", path, sizeof(path));
+		parseAssets(path);
+	}
+
+	// what MenuParse_font does
+	for (i = 0; i < cacheMenuCount; i++)
+	{
+		if (cacheMenus[i].font && !DC->Assets.fontRegistered)
+		{
+			DC->registerFont(cacheMenus[i].font, 48, &DC->Assets.textFont);
+			DC->Assets.fontRegistered = qtrue;
+		}
+	}
+
+	menuCount += cacheMenuCount;
+	return qtrue;
+}
+
 displayContextDef_t *Display_GetContext()
 {
 	return DC;